@@ -0,0 +1,254 @@
+/*
+ * Micro-benchmark driver for the wrapper internals.
+ *
+ * Built by `make bench-driver` together with the vendored engine
+ * sources. It embeds the interpreter and includes src/lsm.c directly,
+ * so the static helpers (pylsm_getitem, pylsm_length, the compressor
+ * callbacks, ...) are timed without the Python call stack on top —
+ * comparing these numbers against benchmarks/bench_wrapper.py isolates
+ * wrapper overhead from engine cost.
+ *
+ * Usage: bench_driver [none|lz4|zstd] [value_size]
+ *
+ * Emits one JSON object per line on stdout so runs can be diffed by
+ * machines, not eyeballs.
+ */
+
+#include "../src/lsm.c"
+
+#define BENCH_KEYS 100000
+#define BENCH_KEY_FMT "k%08d"
+
+static double bench_now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+
+static void bench_report(const char *name, long iterations, double elapsed_ns) {
+	printf(
+		"{\"name\": \"%s\", \"iterations\": %ld, \"ns_per_op\": %.1f}\n",
+		name, iterations, elapsed_ns / (double) iterations
+	);
+	fflush(stdout);
+}
+
+
+static void bench_inserts(LSM *db, const char *value, int value_size) {
+	char key[32];
+	double started = bench_now();
+
+	for (int i = 0; i < BENCH_KEYS; i++) {
+		int nKey = snprintf(key, sizeof(key), BENCH_KEY_FMT, i);
+		LSM_WriteLock(db);
+		pylsm_insert_tracked(db, key, nKey, value, value_size);
+		LSM_WriteUnlock(db);
+	}
+
+	bench_report("insert", BENCH_KEYS, bench_now() - started);
+}
+
+
+static void bench_gets(LSM *db, int miss) {
+	char key[32];
+	char *pVal;
+	int nVal;
+	double started = bench_now();
+
+	for (int i = 0; i < BENCH_KEYS; i++) {
+		int nKey = snprintf(
+			key, sizeof(key), miss ? "m%08d" : BENCH_KEY_FMT, i
+		);
+
+		pVal = NULL;
+		LSM_ReadLock(db);
+		pylsm_getitem(db, key, nKey, &pVal, &nVal, LSM_SEEK_EQ);
+		LSM_ReadUnlock(db);
+		if (pVal != NULL) free(pVal);
+	}
+
+	bench_report(miss ? "get_miss" : "get_hit", BENCH_KEYS, bench_now() - started);
+}
+
+
+static void bench_contains(LSM *db) {
+	char key[32];
+	double started = bench_now();
+
+	for (int i = 0; i < BENCH_KEYS; i++) {
+		int nKey = snprintf(key, sizeof(key), BENCH_KEY_FMT, i);
+		LSM_ReadLock(db);
+		pylsm_contains(db, key, nKey);
+		LSM_ReadUnlock(db);
+	}
+
+	bench_report("contains", BENCH_KEYS, bench_now() - started);
+}
+
+
+static void bench_length(LSM *db) {
+	Py_ssize_t result = 0;
+	double started = bench_now();
+	int iterations = 10;
+
+	for (int i = 0; i < iterations; i++) {
+		LSM_ReadLock(db);
+		pylsm_length(db, &result);
+		LSM_ReadUnlock(db);
+	}
+
+	bench_report("length", iterations, bench_now() - started);
+}
+
+
+static void bench_range_scan(LSM *db) {
+	Py_ssize_t count = 0;
+	double started = bench_now();
+	int iterations = 10;
+
+	for (int i = 0; i < iterations; i++) {
+		count = 0;
+		LSM_ReadLock(db);
+		pylsm_range_scan(
+			db, "k00000000", 9, "k99999999", 9, &count, NULL
+		);
+		LSM_ReadUnlock(db);
+	}
+
+	bench_report("range_scan", iterations * BENCH_KEYS, bench_now() - started);
+}
+
+
+// Slice iteration goes through the Python iterator protocol: the
+// interesting cost (pylsm_slice_next and the stop-bound memcmp) has no
+// entry point that can be driven without a live LSMSliceView object.
+static void bench_slice(PyObject *pyDb) {
+	PyObject *slice = PySlice_New(
+		PyBytes_FromString("k00000000"),
+		PyBytes_FromString("k00010000"),
+		NULL
+	);
+	double started = bench_now();
+	long entries = 0;
+	int iterations = 10;
+
+	for (int i = 0; i < iterations; i++) {
+		PyObject *view = PyObject_GetItem(pyDb, slice);
+		PyObject *iter = PyObject_GetIter(view);
+		PyObject *item;
+
+		while ((item = PyIter_Next(iter)) != NULL) {
+			entries++;
+			Py_DECREF(item);
+		}
+
+		Py_DECREF(iter);
+		Py_DECREF(view);
+	}
+
+	Py_DECREF(slice);
+	bench_report("slice", entries, bench_now() - started);
+}
+
+
+static void bench_compressor(LSM *db, const char *compress, int value_size) {
+	if (!db->compressed) return;
+
+	char *src = malloc(value_size);
+	int bound, n;
+	char name[64];
+	double started;
+	int iterations = 100000;
+
+	// repetitive but not constant, like real payloads
+	for (int i = 0; i < value_size; i++) src[i] = (char) ((i * 31) % 251);
+
+	bound = db->lsm_compress.xBound(db, value_size);
+	char *dst = malloc(bound);
+	char *back = malloc(value_size);
+
+	started = bench_now();
+	for (int i = 0; i < iterations; i++) {
+		n = bound;
+		db->lsm_compress.xCompress(db, dst, &n, src, value_size);
+	}
+	snprintf(name, sizeof(name), "%s_compress", compress);
+	bench_report(name, iterations, bench_now() - started);
+
+	n = bound;
+	db->lsm_compress.xCompress(db, dst, &n, src, value_size);
+
+	started = bench_now();
+	for (int i = 0; i < iterations; i++) {
+		int m = value_size;
+		db->lsm_compress.xUncompress(db, back, &m, dst, n);
+	}
+	snprintf(name, sizeof(name), "%s_uncompress", compress);
+	bench_report(name, iterations, bench_now() - started);
+
+	free(src);
+	free(dst);
+	free(back);
+}
+
+
+int main(int argc, char *argv[]) {
+	const char *compress = argc > 1 ? argv[1] : "none";
+	int value_size = argc > 2 ? atoi(argv[2]) : 64;
+	char path[] = "bench_driver.lsm";
+
+	if (value_size < 1) {
+		fprintf(stderr, "invalid value size\n");
+		return 1;
+	}
+
+	unlink(path);
+
+	PyImport_AppendInittab("lsm", PyInit_lsm);
+	Py_Initialize();
+
+	PyObject *module = PyImport_ImportModule("lsm");
+	if (module == NULL) { PyErr_Print(); return 1; }
+
+	PyObject *type = PyObject_GetAttrString(module, "LSM");
+	PyObject *cargs = Py_BuildValue("(s)", path);
+	PyObject *ckwargs = Py_BuildValue("{s:s}", "compress", compress);
+	PyObject *pyDb = type ? PyObject_Call(type, cargs, ckwargs) : NULL;
+
+	Py_XDECREF(type);
+	Py_XDECREF(cargs);
+	Py_XDECREF(ckwargs);
+
+	if (pyDb == NULL) { PyErr_Print(); return 1; }
+
+	Py_XDECREF(PyObject_CallMethod(pyDb, "open", NULL));
+	if (PyErr_Occurred()) { PyErr_Print(); return 1; }
+
+	LSM *db = (LSM*) pyDb;
+	char *value = malloc(value_size);
+	for (int i = 0; i < value_size; i++) value[i] = (char) ((i * 17) % 256);
+
+	printf(
+		"{\"compress\": \"%s\", \"value_size\": %d, \"keys\": %d}\n",
+		compress, value_size, BENCH_KEYS
+	);
+
+	bench_inserts(db, value, value_size);
+	bench_gets(db, 0);
+	bench_gets(db, 1);
+	bench_contains(db);
+	bench_length(db);
+	bench_range_scan(db);
+	bench_slice(pyDb);
+	bench_compressor(db, compress, value_size);
+
+	free(value);
+	Py_XDECREF(PyObject_CallMethod(pyDb, "close", NULL));
+	Py_DECREF(pyDb);
+	Py_DECREF(module);
+	Py_FinalizeEx();
+
+	unlink(path);
+	return 0;
+}
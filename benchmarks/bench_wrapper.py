@@ -0,0 +1,100 @@
+"""Python-level benchmarks measured with pyperf.
+
+Covers insert/get/scan/slice across value sizes and both compressors
+through the public API — the numbers include the full Python call
+stack. The C driver (bench_driver.c) measures the same operations
+against the wrapper internals; the difference between the two is the
+binding overhead.
+
+Run `make bench-py` to produce a machine-readable JSON file, keep a
+known-good run as benchmarks/baseline.json and compare releases with
+`make bench-compare`.
+"""
+
+import shutil
+import tempfile
+
+import pyperf
+
+import lsm
+
+VALUE_SIZES = (64, 4096)
+COMPRESSORS = ("none", "lz4", "zstd")
+KEYS = 10000
+
+
+def make_db(workdir, compress, value_size, fill=False):
+    db = lsm.LSM(
+        "{}/bench-{}-{}.lsm".format(workdir, compress, value_size),
+        compress=compress,
+    )
+    db.open()
+    if fill:
+        value = bytes(i % 256 for i in range(value_size))
+        db.update((key(i), value) for i in range(KEYS))
+    return db
+
+
+def key(i):
+    return b"k%08d" % i
+
+
+def bench_insert(loops, db, value_size):
+    value = bytes(i % 256 for i in range(value_size))
+    t0 = pyperf.perf_counter()
+    for loop in range(loops):
+        db[key(loop % KEYS)] = value
+    return pyperf.perf_counter() - t0
+
+
+def bench_get(loops, db):
+    t0 = pyperf.perf_counter()
+    for loop in range(loops):
+        db[key(loop % KEYS)]
+    return pyperf.perf_counter() - t0
+
+
+def bench_scan(loops, db):
+    t0 = pyperf.perf_counter()
+    for _ in range(loops):
+        for _ in db.keys():
+            pass
+    return pyperf.perf_counter() - t0
+
+
+def bench_slice(loops, db):
+    start, stop = key(0), key(KEYS // 10)
+    t0 = pyperf.perf_counter()
+    for _ in range(loops):
+        for _ in db[start:stop]:
+            pass
+    return pyperf.perf_counter() - t0
+
+
+def main():
+    runner = pyperf.Runner()
+    workdir = tempfile.mkdtemp(prefix="lsm-bench-")
+
+    try:
+        for compress in COMPRESSORS:
+            for value_size in VALUE_SIZES:
+                suffix = "[{}/{}b]".format(compress, value_size)
+
+                db = make_db(workdir, compress, value_size)
+                runner.bench_time_func(
+                    "insert" + suffix, bench_insert, db, value_size,
+                    inner_loops=1,
+                )
+                db.close()
+
+                db = make_db(workdir, compress, value_size, fill=True)
+                runner.bench_time_func("get" + suffix, bench_get, db)
+                runner.bench_time_func("scan" + suffix, bench_scan, db)
+                runner.bench_time_func("slice" + suffix, bench_slice, db)
+                db.close()
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,5 @@
 from typing import (
-    Any, Callable, Dict, Union, Optional, Tuple,
+    Any, Callable, Dict, Iterable, Union, Optional, Sequence, Tuple,
     KeysView, ValuesView, ItemsView, Mapping
 )
 
@@ -19,6 +19,7 @@ SEEK_LEFAST: int
 
 class Transaction:
     level: int
+    group: bool
     def __enter__(self) -> "Transaction": ...
     def __exit__(self, exc_type, exc_val, exc_tb) -> None: ...
     def commit(self) -> bool: ...
@@ -40,11 +41,24 @@ class Cursor:
     ]: ...
     def next(self) -> bool: ...
     def previous(self) -> bool: ...
+    def fetch(
+        self, n: int
+    ) -> Sequence[Tuple[Union[bytes, str], Union[bytes, str]]]: ...
     def compare(self, key: Union[bytes, str]) -> int: ...
     def __enter__(self) -> "Cursor": ...
     def __exit__(self, exc_type, exc_val, exc_tb) -> None: ...
 
 
+class WriteBatch:
+    def __enter__(self) -> "WriteBatch": ...
+    def __exit__(self, exc_type, exc_val, exc_tb) -> None: ...
+    def put(self, key: Union[bytes, str], value: Union[bytes, str]) -> None: ...
+    def delete(self, key: Union[bytes, str]) -> None: ...
+    def clear(self) -> None: ...
+    def apply(self) -> None: ...
+    def __len__(self) -> int: ...
+
+
 class LSM:
     path: str
     compressed: bool
@@ -63,6 +77,12 @@ class LSM:
     compress: str
     compress_level: int
     tx_level: int
+    cursor_pool_size: int
+    iter_prefetch: int
+    eager_work: bool
+    logger_buffered: bool
+    bloom_bits_per_key: int
+    compress_adaptive: bool
 
     def __init__(
         self, path: Any, *,
@@ -78,19 +98,31 @@ class LSM:
         use_log: bool = True,
         multiple_processes: bool = True,
         readonly: bool = False,
-        binary: bool = True,
+        binary: Union[bool, str] = True,
         logger: Callable[[str, int], Any] = None,
         compress: str = None,
         compress_level: int = None,
+        cursor_pool_size: int = 4,
+        compress_dict: bytes = None,
+        iter_prefetch: int = 256,
+        eager_work: bool = True,
+        logger_buffered: bool = False,
+        bloom_bits_per_key: int = 0,
+        compress_adaptive: bool = False,
     ): ...
 
     def open(self) -> bool: ...
     def close(self) -> bool: ...
-    def info(self) -> Dict[str, int]: ...
+    def info(self) -> Dict[str, Any]: ...
+    def stats(self) -> Dict[str, int]: ...
+    def drain_logs(self) -> int: ...
     def work(
         self, *, nmerge: int = 4, nkb: int = 1024, complete: bool = True
     ) -> int: ...
     def flush(self) -> bool: ...
+    def start_worker(self, *, nmerge: int = 4, nkb: int = 2048) -> bool: ...
+    def stop_worker(self) -> bool: ...
+    def worker_stats(self) -> Dict[str, Any]: ...
     def __enter__(self) -> "LSM": ...
     def __exit__(self, exc_type, exc_val, exc_tb) -> None: ...
     def checkpoint(self) -> int: ...
@@ -117,8 +149,43 @@ class LSM:
     def values(self) -> ValuesView[Union[bytes, str]]: ...
     def items(self) -> ItemsView[Union[bytes, str], Union[bytes, str]]: ...
     def update(
-        self, value: Mapping[Union[bytes, str], Union[bytes, str]]
+        self, value: Union[
+            Mapping[Union[bytes, str], Union[bytes, str]],
+            Iterable[Tuple[Union[bytes, str], Union[bytes, str]]],
+        ]
+    ) -> None: ...
+    def bulk_load(
+        self, items: Iterable[Tuple[Union[bytes, str], Union[bytes, str]]]
     ) -> None: ...
-    def transaction(self) -> Transaction: ...
-    def tx(self) -> Transaction: ...
+    def transaction(self, group: bool = False) -> Transaction: ...
+    def tx(self, group: bool = False) -> Transaction: ...
+    def write_batch(self) -> WriteBatch: ...
+    def delete_many(self, keys: Iterable[Union[bytes, str]]) -> None: ...
+    def snapshot(self) -> "LSM": ...
+    def advise(
+        self, mode: str, *, offset: int = 0, length: int = 0
+    ) -> None: ...
+    def backup(
+        self, path: Any, *,
+        chunk_size: int = 4194304,
+        progress: Callable[[int, int], Any] = None,
+    ) -> int: ...
+    def count(self, exact: bool = False) -> int: ...
+    def read_range(
+        self, start: Union[bytes, str], stop: Union[bytes, str],
+        limit: int = -1,
+    ) -> Sequence[Tuple[Union[bytes, str], Union[bytes, str]]]: ...
+    def count_range(
+        self, start: Union[bytes, str], stop: Union[bytes, str]
+    ) -> int: ...
+    def partitions(
+        self, n: int
+    ) -> Sequence[Tuple[Union[bytes, str], Union[bytes, str]]]: ...
+    def estimate_size(
+        self, start: Union[bytes, str], stop: Union[bytes, str]
+    ) -> int: ...
+    def getview(self, key: Union[bytes, str]) -> memoryview: ...
+    def getmany(
+        self, keys: Sequence[Union[bytes, str]], default: Any = None
+    ) -> Dict[Union[bytes, str], Any]: ...
     def __len__(self) -> int: ...
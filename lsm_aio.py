@@ -0,0 +1,223 @@
+"""Asyncio facade over :class:`lsm.LSM`.
+
+Every engine call blocks the calling thread, so asyncio services end up
+wrapping each operation in ``run_in_executor`` and paying a thread-pool
+handoff per key. :class:`AsyncLSM` runs one dedicated worker thread per
+database instead: coroutines append operations to a queue and the
+worker drains the whole queue on each wakeup, applying runs of
+consecutive writes as a single :meth:`lsm.LSM.write_batch` and runs of
+consecutive point reads as one :meth:`lsm.LSM.getmany` call. Under
+load the handoff and lock cost is paid once per drained batch rather
+than once per operation, while per-key submission order is preserved.
+
+    async with AsyncLSM("db.lsm", binary=False) as db:
+        await db.aset("key", "value")
+        value = await db.aget("key")
+"""
+
+import asyncio
+import threading
+from collections import deque
+
+import lsm
+
+_GET = 0
+_SET = 1
+_DELETE = 2
+_CALL = 3
+_CLOSE = 4
+
+_MISSING = object()
+
+
+class AsyncLSM:
+    def __init__(self, path, **kwargs):
+        self._db = lsm.LSM(path, **kwargs)
+        self._queue = deque()
+        self._wakeup = threading.Event()
+        self._thread = None
+        self._closed = False
+
+    @property
+    def db(self):
+        """The wrapped synchronous connection."""
+        return self._db
+
+    async def open(self):
+        loop = asyncio.get_running_loop()
+        await loop.run_in_executor(None, self._db.open)
+        self._thread = threading.Thread(
+            target=self._worker,
+            name="lsm-aio-worker[{}]".format(self._db.path),
+            daemon=True,
+        )
+        self._thread.start()
+        return True
+
+    async def close(self):
+        if self._closed:
+            return False
+        self._closed = True
+        result = await self._submit(_CLOSE)
+        loop = asyncio.get_running_loop()
+        await loop.run_in_executor(None, self._thread.join)
+        return result
+
+    async def __aenter__(self):
+        if self._thread is None:
+            await self.open()
+        return self
+
+    async def __aexit__(self, exc_type, exc_val, exc_tb):
+        await self.close()
+
+    async def aget(self, key, default=_MISSING):
+        try:
+            return await self._submit(_GET, key)
+        except KeyError:
+            if default is _MISSING:
+                raise
+            return default
+
+    async def aset(self, key, value):
+        return await self._submit(_SET, key, value)
+
+    async def adelete(self, key):
+        """Delete a key; absent keys are ignored, like LSM.delete()."""
+        return await self._submit(_DELETE, key)
+
+    async def agetmany(self, keys, default=None):
+        return await self._submit(_CALL, self._db.getmany, keys, default)
+
+    async def aupdate(self, items):
+        return await self._submit(_CALL, self._db.update, items)
+
+    async def awork(self, **kwargs):
+        return await self._submit(
+            _CALL, lambda: self._db.work(**kwargs)
+        )
+
+    async def aflush(self):
+        return await self._submit(_CALL, self._db.flush)
+
+    def _submit(self, kind, *payload):
+        if self._thread is None:
+            raise RuntimeError("Database has not opened")
+        if self._closed and kind != _CLOSE:
+            raise RuntimeError("Database closed")
+        loop = asyncio.get_running_loop()
+        future = loop.create_future()
+        self._queue.append((kind, payload, future, loop))
+        self._wakeup.set()
+        return future
+
+    @staticmethod
+    def _resolve(future, loop, value=None, exc=None):
+        def finish():
+            if future.done():
+                return
+            if exc is not None:
+                future.set_exception(exc)
+            else:
+                future.set_result(value)
+
+        loop.call_soon_threadsafe(finish)
+
+    def _drain(self):
+        drained = []
+        while True:
+            try:
+                drained.append(self._queue.popleft())
+            except IndexError:
+                return drained
+
+    def _apply_writes(self, ops):
+        try:
+            with self._db.write_batch() as batch:
+                for kind, payload, _, _ in ops:
+                    if kind == _SET:
+                        batch.put(*payload)
+                    else:
+                        batch.delete(*payload)
+        except BaseException as e:
+            for _, _, future, loop in ops:
+                self._resolve(future, loop, exc=e)
+        else:
+            for _, _, future, loop in ops:
+                self._resolve(future, loop)
+
+    def _apply_gets(self, ops):
+        keys = [payload[0] for _, payload, _, _ in ops]
+        try:
+            found = self._db.getmany(keys, default=_MISSING)
+        except BaseException as e:
+            for _, _, future, loop in ops:
+                self._resolve(future, loop, exc=e)
+            return
+
+        for _, payload, future, loop in ops:
+            value = found.get(payload[0], _MISSING)
+            if value is _MISSING:
+                self._resolve(future, loop, exc=KeyError(payload[0]))
+            else:
+                self._resolve(future, loop, value=value)
+
+    def _worker(self):
+        running = True
+
+        while running:
+            self._wakeup.wait()
+            self._wakeup.clear()
+            drained = self._drain()
+
+            i = 0
+            while i < len(drained):
+                kind = drained[i][0]
+
+                if kind in (_SET, _DELETE):
+                    j = i
+                    while j < len(drained) and drained[j][0] in (_SET, _DELETE):
+                        j += 1
+                    self._apply_writes(drained[i:j])
+                    i = j
+                elif kind == _GET:
+                    j = i
+                    while j < len(drained) and drained[j][0] == _GET:
+                        j += 1
+                    self._apply_gets(drained[i:j])
+                    i = j
+                elif kind == _CALL:
+                    _, payload, future, loop = drained[i]
+                    try:
+                        result = payload[0](*payload[1:])
+                    except BaseException as e:
+                        self._resolve(future, loop, exc=e)
+                    else:
+                        self._resolve(future, loop, value=result)
+                    i += 1
+                else:  # _CLOSE
+                    _, _, future, loop = drained[i]
+                    try:
+                        result = self._db.close()
+                    except BaseException as e:
+                        self._resolve(future, loop, exc=e)
+                    else:
+                        self._resolve(future, loop, value=result)
+                    running = False
+
+                    # everything submitted after close loses
+                    for _, _, late_future, late_loop in drained[i + 1:]:
+                        self._resolve(
+                            late_future, late_loop,
+                            exc=RuntimeError("Database closed"),
+                        )
+                    break
+
+        # A submission may still slip in between the final drain and
+        # the caller observing _closed; nothing will ever drain it, so
+        # fail it here instead of leaving its future pending forever.
+        for _, _, late_future, late_loop in self._drain():
+            self._resolve(
+                late_future, late_loop,
+                exc=RuntimeError("Database closed"),
+            )
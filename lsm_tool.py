@@ -1,10 +1,16 @@
 import sys
+import threading
 import time
 from argparse import ArgumentParser
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 
 from lsm import LSM, SAFETY_OFF
 
+# Entries buffered per worker before they are handed to the destination
+# in one sorted bulk_load call.
+COPY_CHUNK = 8192
+
 
 def main():
     parser = ArgumentParser(
@@ -41,6 +47,11 @@ def main():
         "--dest-page-size", choices=list(str(1024 << i) for i in range(7)),
         help="Destination file page_size"
     )
+    parser.add_argument(
+        "-j", "--jobs", type=int, default=1,
+        help="Copy this many key ranges in parallel, each over its own "
+             "read-only source connection"
+    )
 
     arguments = parser.parse_args()
 
@@ -67,24 +78,72 @@ def main():
         sys.stderr.write(f"{idx:>10}")
         sys.stderr.flush()
 
+    if arguments.jobs < 1:
+        parser.error("--jobs must be a positive integer")
+
     with LSM(arguments.source, readonly=True) as src, dest:
-        idx = 0
-        log_progress(idx)
+        log_progress(0)
         started_at = time.monotonic()
 
-        for idx, (key, value) in enumerate(src.items()):
-            dest[key] = value
-            if idx % 1024 == 0:
-                log_progress(idx)
+        if arguments.jobs == 1:
+            idx = 0
+            for idx, (key, value) in enumerate(src.items()):
+                dest[key] = value
+                if idx % 1024 == 0:
+                    log_progress(idx)
+            copied = idx
+        else:
+            copied = copy_parallel(src, dest, arguments.jobs, log_progress)
 
-        log_progress(idx)
+        log_progress(copied)
         finished_at = time.monotonic()
 
         sys.stdout.write("\n")
         sys.stdout.write(
-            f"Copied {idx} items in {finished_at - started_at} seconds\n"
+            f"Copied {copied} items in {finished_at - started_at} seconds\n"
         )
 
 
+def copy_parallel(src, dest, jobs, log_progress):
+    """Copy src to dest with one thread per count-balanced key range.
+
+    Every worker iterates its range on a private snapshot connection
+    (the extension releases the GIL around cursor walks, so source-side
+    decompression and page reads genuinely overlap) and appends sorted
+    chunks to the destination through bulk_load, which serializes the
+    writers on the destination lock but keeps the read side parallel.
+    """
+    progress_lock = threading.Lock()
+    copied = 0
+
+    def worker(bounds):
+        nonlocal copied
+        start, stop = bounds
+        chunk = []
+
+        def drain():
+            nonlocal copied
+            dest.bulk_load(chunk)
+            with progress_lock:
+                copied += len(chunk)
+                log_progress(copied)
+            del chunk[:]
+
+        with src.snapshot() as snap:
+            for key, value in snap[start:stop]:
+                chunk.append((key, value))
+                if len(chunk) >= COPY_CHUNK:
+                    drain()
+            if chunk:
+                drain()
+
+    with ThreadPoolExecutor(jobs) as pool:
+        # Raise the first worker error, if any
+        for _ in pool.map(worker, src.partitions(jobs)):
+            pass
+
+    return copied
+
+
 if __name__ == '__main__':
     main()
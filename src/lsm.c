@@ -4,6 +4,14 @@
 #include <structmember.h>
 #include <string.h>
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef LSM_MUTEX_PTHREADS
+#include <pthread.h>
+#include <time.h>
+#endif
 
 #include "lz4/lib/lz4.h"
 #include "zstd/lib/zstd.h"
@@ -16,6 +24,65 @@
 #define LZ4_COMP_LEVEL_DEFAULT 16
 #define LZ4_COMP_LEVEL_MAX 16
 
+// compress_adaptive=True: per-page flag byte plus auto-tuned lz4
+// acceleration, retuned from the accumulated ratio every sample window.
+#define PYLSM_ADAPTIVE_RAW 0
+#define PYLSM_ADAPTIVE_COMPRESSED 1
+#define PYLSM_ADAPTIVE_SAMPLE_PAGES 64
+#define PYLSM_LZ4_ACCEL_MIN 1
+#define PYLSM_LZ4_ACCEL_MAX 65537
+
+#define PYLSM_UPDATE_CHUNK 1024
+#define PYLSM_BULK_CHUNK 8192
+#define PYLSM_ITER_PREFETCH_DEFAULT 256
+#define PYLSM_ITER_PREFETCH_MAX 65536
+
+#define PYLSM_LOG_RING_SIZE 1024
+#define PYLSM_LOG_MSG_MAX 232
+
+#define PYLSM_BACKUP_CHUNK_DEFAULT (4 * 1024 * 1024)
+
+#define PYLSM_INT_KEY_SIZE 8
+
+#define PYLSM_BUF_POOL_SIZE 8
+#define PYLSM_BUF_CLASS 256
+
+// Sentinel rc: a group-commit batch was rolled back by one of its
+// members, so the coalesced commits never became durable.
+#define PYLSM_GROUP_ABORTED (-2)
+
+#define PYLSM_BLOOM_MAX_BITS_PER_KEY 64
+#define PYLSM_BLOOM_MIN_KEYS 4096
+#define PYLSM_BLOOM_HEADROOM 2
+
+// Lock-free operation counters; cheap enough to bump on every call.
+#define PYLSM_STAT_ADD(self, field, n) \
+	__atomic_fetch_add(&(self)->field, (long long) (n), __ATOMIC_RELAXED)
+
+// On free-threaded builds (Py_GIL_DISABLED) the GIL no longer protects
+// the connection state fields that are visible across threads, so their
+// transitions go through atomics; with the GIL these compile down to a
+// plain load and store. Engine access itself is already serialized by
+// the reader/writer lock, and cursor/view/batch objects stay owned by
+// one thread at a time — sharing a live iterator between threads is
+// unsupported with or without the GIL.
+#ifdef Py_GIL_DISABLED
+#define PYLSM_FIELD_SET(self, field, value) \
+	__atomic_store_n(&(self)->field, (value), __ATOMIC_RELEASE)
+#define PYLSM_FIELD_GET(self, field) \
+	__atomic_load_n(&(self)->field, __ATOMIC_ACQUIRE)
+#else
+#define PYLSM_FIELD_SET(self, field, value) ((self)->field = (value))
+#define PYLSM_FIELD_GET(self, field) ((self)->field)
+#endif
+
+typedef struct {
+	int  rc;
+	char ready;
+	char message[PYLSM_LOG_MSG_MAX];
+} LSMLogEntry;
+
+
 typedef struct {
 	PyObject_HEAD
 	char         *path;
@@ -35,10 +102,71 @@ typedef struct {
 	int          multiple_processes;
 	int          autocheckpoint;
 	int          readonly;
+	int          eager_work;
 	int 	     tx_level;
 	int          compress_level;
 	char		 binary;
+	lsm_i64      key_count;
+	char         key_count_valid;
+	lsm_cursor   **csr_pool;
+	int          csr_pool_size;
+	int          csr_pool_used;
+	char         *buf_pool[PYLSM_BUF_POOL_SIZE];
+	size_t       buf_pool_cap[PYLSM_BUF_POOL_SIZE];
+	int          buf_pool_used;
+	int          iter_prefetch;
+	int          bloom_bits_per_key;
+	char         *bloom;
+	uint64_t     bloom_nbits;
+	int          bloom_hashes;
+	long long    stat_gets;
+	long long    stat_inserts;
+	long long    stat_deletes;
+	long long    stat_cursors;
+	long long    stat_lock_wait_ns;
+	long long    stat_pages_raw;
+	long long    stat_pages_compressed;
+	long long    stat_group_commits;
+	long long    stat_group_syncs;
+	int          compress_adaptive;
+	int          lz4_acceleration;
+	long long    adapt_in_bytes;
+	long long    adapt_out_bytes;
+	long long    adapt_pages;
+	ZSTD_CCtx    *zstd_cctx;
+	ZSTD_DCtx    *zstd_dctx;
+	char         *compress_dict;
+	Py_ssize_t   compress_dict_len;
+	lsm_mutex    *zstd_mutex;
+#ifdef LSM_MUTEX_PTHREADS
+	pthread_t       worker_thread;
+	pthread_mutex_t worker_mutex;
+	pthread_cond_t  worker_cond;
+	lsm_db          *worker_lsm;
+	int             worker_state;
+	int             worker_nmerge;
+	int             worker_nkb;
+	int             worker_pending;
+	long long       worker_written;
+	long long       worker_checkpointed;
+	pthread_rwlock_t rwlock;
+	pthread_mutex_t  pool_mutex;
+	pthread_mutex_t  group_mutex;
+	pthread_cond_t   group_cond;
+	int              group_open;
+	int              group_active;
+	int              group_pending;
+	int              group_departing;
+	int              group_poisoned;
+	int              group_rc;
+	unsigned long long group_generation;
+#endif
 	PyObject     *logger;
+	int          logger_buffered;
+	LSMLogEntry  *log_ring;
+	unsigned long long log_head;
+	unsigned long long log_tail;
+	long long    log_dropped;
 	lsm_compress lsm_compress;
 	lsm_env      *lsm_env;
 	lsm_mutex    *lsm_mutex;
@@ -56,11 +184,24 @@ typedef struct {
 } LSMCursor;
 
 
+typedef struct {
+	char *pKey;
+	int  nKey;
+	char *pVal;
+	int  nVal;
+} LSMPrefetchItem;
+
+
 typedef struct {
 	PyObject_HEAD
 	LSM *db;
 	uint8_t	   state;
 	lsm_cursor *cursor;
+	LSMPrefetchItem *prefetch;
+	int        prefetch_cap;
+	int        prefetch_used;
+	int        prefetch_pos;
+	char       exhausted;
 	PyObject*  weakrefs;
 } LSMIterView;
 
@@ -78,12 +219,16 @@ typedef struct {
 	char* pStop;
 	Py_ssize_t nStop;
 
+	// int-key mode packs the bounds here, so the pointers above never
+	// dangle into a temporary
+	char packed_start[PYLSM_INT_KEY_SIZE];
+	char packed_stop[PYLSM_INT_KEY_SIZE];
+
 	int state;
 
 	long step;
 	char direction;
 
-	Py_ssize_t counter;
 	PyObject* weakrefs;
 } LSMSliceView;
 
@@ -93,10 +238,41 @@ typedef struct {
 	LSM *db;
 	int tx_level;
 	int state;
+	char group;
 	PyObject* weakrefs;
 } LSMTransaction;
 
 
+typedef struct {
+	char *pKey;
+	int  nKey;
+	char *pVal;		// NULL marks a delete
+	int  nVal;
+} LSMBatchOp;
+
+
+typedef struct {
+	PyObject_HEAD
+	LSM *db;
+	int state;
+	LSMBatchOp *ops;
+	Py_ssize_t ops_used;
+	Py_ssize_t ops_cap;
+	PyObject* weakrefs;
+} LSMWriteBatch;
+
+
+typedef struct {
+	PyObject_HEAD
+	LSM *db;
+	lsm_cursor *cursor;
+	const char *pValue;
+	Py_ssize_t nValue;
+	Py_ssize_t exports;
+	PyObject* weakrefs;
+} LSMValueView;
+
+
 static PyTypeObject LSMType;
 static PyTypeObject LSMCursorType;
 static PyTypeObject LSMKeysType;
@@ -104,10 +280,13 @@ static PyTypeObject LSMValuesType;
 static PyTypeObject LSMItemsType;
 static PyTypeObject LSMSliceType;
 static PyTypeObject LSMTransactionType;
+static PyTypeObject LSMValueViewType;
+static PyTypeObject LSMWriteBatchType;
 
 
 static PyObject* LSMCursor_new(PyTypeObject*, LSM*, int);
 static PyObject* LSMTransaction_new(PyTypeObject *type, LSM*);
+static PyObject* LSMWriteBatch_new(PyTypeObject *type, LSM*);
 
 
 enum {
@@ -122,11 +301,27 @@ enum {
 	PY_LSM_SLICE_BACKWARD = 1
 };
 
+// Key modes carried in LSM.binary. STR and BYTES are the historical
+// False/True values; INT stores keys as unsigned 64-bit integers packed
+// big-endian, which preserves numeric order under the engine's memcmp.
+enum {
+	PY_LSM_KEY_STR = 0,
+	PY_LSM_KEY_BYTES = 1,
+	PY_LSM_KEY_INT = 2
+};
+
 enum {
 	PY_LSM_COMPRESSOR_EMPTY = LSM_COMPRESSION_EMPTY,
 	PY_LSM_COMPRESSOR_NONE = LSM_COMPRESSION_NONE,
 	PY_LSM_COMPRESSOR_LZ4 = 1024,
 	PY_LSM_COMPRESSOR_ZSTD = 2048,
+	// Adaptive variants prepend a flag byte per page, so files written
+	// with them are not byte-compatible with the plain ids above. A
+	// distinct iId keeps the on-disk format self-describing: opening
+	// with the wrong mode fails with LSM_MISMATCH instead of returning
+	// garbage.
+	PY_LSM_COMPRESSOR_LZ4_ADAPTIVE = 1025,
+	PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE = 2049,
 };
 
 
@@ -179,18 +374,313 @@ static int pylsm_error(int rc) {
 }
 
 
-static int LSM_MutexLock(LSM* self) {
+// The engine only permits one thread inside a connection at a time:
+// even a read moves page-cache reference counts, LRU and hash chains,
+// and with compression enabled every reader shares the connection's
+// decompression buffer. So both lock flavours below are exclusive and
+// the read/write split survives only as call-site documentation.
+// Threads that genuinely need parallel reads get their own connection
+// through snapshot(). Without pthreads both flavours collapse to the
+// old exclusive env mutex.
+#ifdef LSM_MUTEX_PTHREADS
+// Cumulative time spent blocked on the database lock. The clock is
+// only read on the contended path, so uncontended locking stays a
+// single atomic operation.
+static long long pylsm_lock_wait_start(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (long long) now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+
+static void pylsm_lock_wait_account(LSM* self, long long started) {
+	PYLSM_STAT_ADD(self, stat_lock_wait_ns, pylsm_lock_wait_start() - started);
+}
+#endif
+
+
+static int LSM_WriteLock(LSM* self) {
+#ifdef LSM_MUTEX_PTHREADS
+	if (pthread_rwlock_trywrlock(&self->rwlock) != 0) {
+		long long started = pylsm_lock_wait_start();
+		pthread_rwlock_wrlock(&self->rwlock);
+		pylsm_lock_wait_account(self, started);
+	}
+#else
 	self->lsm_env->xMutexEnter(self->lsm_mutex);
+#endif
 	return LSM_OK;
 }
 
 
-static int LSM_MutexLeave(LSM* self) {
+static int LSM_WriteUnlock(LSM* self) {
+#ifdef LSM_MUTEX_PTHREADS
+	pthread_rwlock_unlock(&self->rwlock);
+#else
 	self->lsm_env->xMutexLeave(self->lsm_mutex);
+#endif
 	return LSM_OK;
 }
 
 
+static int LSM_ReadLock(LSM* self) {
+	return LSM_WriteLock(self);
+}
+
+
+static int LSM_ReadUnlock(LSM* self) {
+	return LSM_WriteUnlock(self);
+}
+
+
+// Short critical section guarding the cursor pool array and the
+// connection cursor list that lsm_csr_open and lsm_csr_close mutate.
+// Now that engine access itself is exclusive this is belt and braces,
+// but it stays: pool surgery is also reached from object deallocation
+// paths whose lock discipline is easier to audit against a dedicated
+// mutex. Unneeded without pthreads — the exclusive mutex already
+// covers it.
+static void pylsm_pool_lock(LSM* self) {
+#ifdef LSM_MUTEX_PTHREADS
+	pthread_mutex_lock(&self->pool_mutex);
+#endif
+}
+
+
+static void pylsm_pool_unlock(LSM* self) {
+#ifdef LSM_MUTEX_PTHREADS
+	pthread_mutex_unlock(&self->pool_mutex);
+#endif
+}
+
+
+// Cursor open/close wrappers for call sites that run under the shared
+// lock: the engine keeps its open cursors on a linked list, so list
+// surgery has to be serialized even between readers.
+static int pylsm_csr_open_shared(LSM* self, lsm_cursor **ppCsr) {
+	int rc;
+	pylsm_pool_lock(self);
+	rc = lsm_csr_open(self->lsm, ppCsr);
+	pylsm_pool_unlock(self);
+	if (rc == LSM_OK) PYLSM_STAT_ADD(self, stat_cursors, 1);
+	return rc;
+}
+
+
+static int pylsm_csr_close_shared(LSM* self, lsm_cursor *cursor) {
+	int rc;
+	pylsm_pool_lock(self);
+	rc = lsm_csr_close(cursor);
+	pylsm_pool_unlock(self);
+	return rc;
+}
+
+
+// Cursor pool. Point operations check a cursor out instead of paying
+// lsm_csr_open/lsm_csr_close per call and reposition it with a seek.
+// Pooled cursors pin the snapshot they were opened against, so every
+// write path drains the pool. All three helpers expect the rwlock held
+// in either mode and serialize on pool_mutex internally.
+static int pylsm_csr_acquire(LSM* self, lsm_cursor **ppCsr) {
+	int rc = LSM_OK;
+	pylsm_pool_lock(self);
+	if (self->csr_pool_used > 0) {
+		*ppCsr = self->csr_pool[--self->csr_pool_used];
+	} else {
+		rc = lsm_csr_open(self->lsm, ppCsr);
+		if (rc == LSM_OK) PYLSM_STAT_ADD(self, stat_cursors, 1);
+	}
+	pylsm_pool_unlock(self);
+	return rc;
+}
+
+
+static void pylsm_csr_release(LSM* self, lsm_cursor *cursor) {
+	pylsm_pool_lock(self);
+	if (self->csr_pool != NULL && self->csr_pool_used < self->csr_pool_size) {
+		self->csr_pool[self->csr_pool_used++] = cursor;
+	} else {
+		lsm_csr_close(cursor);
+	}
+	pylsm_pool_unlock(self);
+}
+
+
+static void pylsm_csr_pool_drain(LSM* self) {
+	pylsm_pool_lock(self);
+	while (self->csr_pool_used > 0) {
+		lsm_csr_close(self->csr_pool[--self->csr_pool_used]);
+	}
+	pylsm_pool_unlock(self);
+}
+
+
+// Value-buffer pool. Read paths that copy a value out while the GIL is
+// released used to malloc/free a fresh buffer per row, which hammers
+// the allocator on hot point-lookup workloads. Instead a handful of
+// buffers are kept per connection and handed out first-fit; requests
+// are rounded up to PYLSM_BUF_CLASS multiples so buffers get reused
+// across slightly different value sizes. Buffers larger than four
+// pages are returned to the allocator rather than hoarded.
+static char* pylsm_buf_acquire(LSM* self, size_t size, size_t* pCap) {
+	char* result = NULL;
+
+	pylsm_pool_lock(self);
+	for (int i = 0; i < self->buf_pool_used; i++) {
+		if (self->buf_pool_cap[i] < size) continue;
+		result = self->buf_pool[i];
+		*pCap = self->buf_pool_cap[i];
+		self->buf_pool_used--;
+		self->buf_pool[i] = self->buf_pool[self->buf_pool_used];
+		self->buf_pool_cap[i] = self->buf_pool_cap[self->buf_pool_used];
+		break;
+	}
+	pylsm_pool_unlock(self);
+
+	if (result != NULL) return result;
+
+	*pCap = (size + PYLSM_BUF_CLASS - 1) / PYLSM_BUF_CLASS * PYLSM_BUF_CLASS;
+	return malloc(*pCap);
+}
+
+
+static void pylsm_buf_release(LSM* self, char* buf, size_t cap) {
+	if (buf == NULL) return;
+
+	if (cap > (size_t) self->page_size * 4) {
+		free(buf);
+		return;
+	}
+
+	pylsm_pool_lock(self);
+	if (self->buf_pool_used < PYLSM_BUF_POOL_SIZE) {
+		self->buf_pool[self->buf_pool_used] = buf;
+		self->buf_pool_cap[self->buf_pool_used] = cap;
+		self->buf_pool_used++;
+		buf = NULL;
+	}
+	pylsm_pool_unlock(self);
+
+	if (buf != NULL) free(buf);
+}
+
+
+static void pylsm_buf_pool_drain(LSM* self) {
+	pylsm_pool_lock(self);
+	while (self->buf_pool_used > 0) {
+		free(self->buf_pool[--self->buf_pool_used]);
+	}
+	pylsm_pool_unlock(self);
+}
+
+
+enum {
+	PY_LSM_WORKER_STOPPED = 0,
+	PY_LSM_WORKER_RUNNING = 1,
+	PY_LSM_WORKER_STOPPING = 2
+};
+
+
+#ifdef LSM_MUTEX_PTHREADS
+// Background merge/checkpoint thread. It owns a second lsm_db
+// connection to the same file, so it never touches lsm_mutex and runs
+// entirely outside the GIL; coordination with foreground writers is
+// done by the engine itself. LSM_BUSY just means the writer side is
+// active right now, so it is retried on the next pass.
+static void* pylsm_worker_main(void* arg) {
+	LSM* self = (LSM*) arg;
+	int rc;
+
+	pthread_mutex_lock(&self->worker_mutex);
+
+	while (self->worker_state == PY_LSM_WORKER_RUNNING) {
+		if (self->worker_pending == 0) {
+			struct timespec deadline;
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_sec += 1;
+			pthread_cond_timedwait(
+				&self->worker_cond, &self->worker_mutex, &deadline
+			);
+		}
+
+		if (self->worker_state != PY_LSM_WORKER_RUNNING) break;
+		self->worker_pending = 0;
+		pthread_mutex_unlock(&self->worker_mutex);
+
+		int written = 0;
+		long long total_written = 0;
+
+		do {
+			written = 0;
+			rc = lsm_work(
+				self->worker_lsm,
+				self->worker_nmerge, self->worker_nkb,
+				&written
+			);
+			total_written += written;
+		} while (rc == LSM_OK && written > 0);
+
+		int checkpointed = 0;
+		lsm_checkpoint(self->worker_lsm, &checkpointed);
+
+		pthread_mutex_lock(&self->worker_mutex);
+		self->worker_written += total_written;
+		self->worker_checkpointed += checkpointed;
+	}
+
+	self->worker_state = PY_LSM_WORKER_STOPPED;
+	pthread_mutex_unlock(&self->worker_mutex);
+	return NULL;
+}
+#endif
+
+
+// Wake the background worker after a write. No-op while it is not
+// running; cheap enough to call from every write path.
+static void pylsm_worker_notify(LSM* self) {
+#ifdef LSM_MUTEX_PTHREADS
+	if (self->worker_lsm == NULL) return;
+
+	pthread_mutex_lock(&self->worker_mutex);
+	if (self->worker_state == PY_LSM_WORKER_RUNNING) {
+		self->worker_pending++;
+		pthread_cond_signal(&self->worker_cond);
+	}
+	pthread_mutex_unlock(&self->worker_mutex);
+#endif
+}
+
+
+// Stop the thread and close the worker connection. Expects the GIL
+// held; releases it around the join.
+static int pylsm_worker_shutdown(LSM* self) {
+	int rc = LSM_OK;
+
+#ifdef LSM_MUTEX_PTHREADS
+	if (self->worker_lsm == NULL) return rc;
+
+	Py_BEGIN_ALLOW_THREADS
+	pthread_mutex_lock(&self->worker_mutex);
+	if (self->worker_state == PY_LSM_WORKER_RUNNING) {
+		self->worker_state = PY_LSM_WORKER_STOPPING;
+	}
+	pthread_cond_signal(&self->worker_cond);
+	pthread_mutex_unlock(&self->worker_mutex);
+
+	pthread_join(self->worker_thread, NULL);
+	Py_END_ALLOW_THREADS
+
+	rc = lsm_close(self->worker_lsm);
+	self->worker_lsm = NULL;
+
+	pthread_cond_destroy(&self->worker_cond);
+	pthread_mutex_destroy(&self->worker_mutex);
+#endif
+
+	return rc;
+}
+
+
 static int pylsm_lz4_xBound(LSM* self, int nIn) {
 	int rc = LZ4_compressBound(nIn);
 	assert(rc > 0);
@@ -220,8 +710,27 @@ static size_t pylsm_zstd_xBound(LSM* self, int nIn) {
 }
 
 
+// The CCtx/DCtx live on the LSM object so page compression does not
+// pay context setup per page. All calls happen under lsm_mutex.
 static size_t pylsm_zstd_xCompress(LSM* self, char *pOut, Py_ssize_t *pnOut, const char *pIn, int nIn) {
-	size_t rc = ZSTD_compress(pOut, *pnOut, pIn, nIn, self->compress_level);
+	size_t rc;
+
+	// both connections (foreground and worker) share the contexts
+	self->lsm_env->xMutexEnter(self->zstd_mutex);
+
+	if (self->compress_dict != NULL) {
+		rc = ZSTD_compress_usingDict(
+			self->zstd_cctx, pOut, *pnOut, pIn, nIn,
+			self->compress_dict, self->compress_dict_len,
+			self->compress_level
+		);
+	} else {
+		rc = ZSTD_compressCCtx(
+			self->zstd_cctx, pOut, *pnOut, pIn, nIn, self->compress_level
+		);
+	}
+
+	self->lsm_env->xMutexLeave(self->zstd_mutex);
 
 	assert(!ZSTD_isError(rc));
 
@@ -231,13 +740,146 @@ static size_t pylsm_zstd_xCompress(LSM* self, char *pOut, Py_ssize_t *pnOut, con
 
 
 static int pylsm_zstd_xUncompress(LSM* self, char *pOut, Py_ssize_t *pnOut, const char *pIn, int nIn) {
-  Py_ssize_t rc = ZSTD_decompress((char*)pOut, *pnOut, (const char*)pIn, nIn);
+  Py_ssize_t rc;
+
+  self->lsm_env->xMutexEnter(self->zstd_mutex);
+
+  if (self->compress_dict != NULL) {
+    rc = ZSTD_decompress_usingDict(
+      self->zstd_dctx, (char*)pOut, *pnOut, (const char*)pIn, nIn,
+      self->compress_dict, self->compress_dict_len
+    );
+  } else {
+    rc = ZSTD_decompressDCtx(
+      self->zstd_dctx, (char*)pOut, *pnOut, (const char*)pIn, nIn
+    );
+  }
+
+  self->lsm_env->xMutexLeave(self->zstd_mutex);
+
   assert(!ZSTD_isError(rc));
   *pnOut = rc;
   return 0;
 }
 
 
+// Retune the lz4 acceleration from the ratio accumulated over the last
+// sample window. Pages that barely shrink mean the data is mostly
+// incompressible, so spend less CPU per page; pages that shrink well
+// mean effort pays off, so lean back towards quality. The counters and
+// the acceleration are racy between the foreground and worker
+// connections, which only skews the tuning, never the output.
+static void pylsm_adaptive_account(LSM* self, int nIn, int nOut) {
+	long long pages, in_bytes, out_bytes;
+	int accel;
+
+	PYLSM_STAT_ADD(self, adapt_in_bytes, nIn);
+	PYLSM_STAT_ADD(self, adapt_out_bytes, nOut);
+	pages = PYLSM_STAT_ADD(self, adapt_pages, 1) + 1;
+
+	if (pages % PYLSM_ADAPTIVE_SAMPLE_PAGES != 0) return;
+
+	in_bytes = __atomic_load_n(&self->adapt_in_bytes, __ATOMIC_RELAXED);
+	out_bytes = __atomic_load_n(&self->adapt_out_bytes, __ATOMIC_RELAXED);
+	if (in_bytes <= 0) return;
+
+	accel = __atomic_load_n(&self->lz4_acceleration, __ATOMIC_RELAXED);
+	if (out_bytes * 10 > in_bytes * 9) {
+		accel *= 2;
+	} else if (out_bytes * 2 < in_bytes) {
+		accel /= 2;
+	}
+	if (accel < PYLSM_LZ4_ACCEL_MIN) accel = PYLSM_LZ4_ACCEL_MIN;
+	if (accel > PYLSM_LZ4_ACCEL_MAX) accel = PYLSM_LZ4_ACCEL_MAX;
+	__atomic_store_n(&self->lz4_acceleration, accel, __ATOMIC_RELAXED);
+}
+
+
+// The engine sizes the output buffer from xBound, so leave room for
+// the flag byte plus the raw page for the store-verbatim case.
+static int pylsm_adaptive_xBound(LSM* self, int nIn) {
+	size_t bound;
+
+	if (self->lsm_compress.iId == PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE) {
+		bound = ZSTD_compressBound(nIn);
+	} else {
+		bound = (size_t) LZ4_compressBound(nIn);
+	}
+	if (bound < (size_t) nIn) bound = (size_t) nIn;
+	return (int) bound + 1;
+}
+
+
+static int pylsm_adaptive_xCompress(LSM* self, char *pOut, int *pnOut, const char *pIn, int nIn) {
+	int nOut;
+
+	if (self->lsm_compress.iId == PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE) {
+		size_t rc;
+
+		self->lsm_env->xMutexEnter(self->zstd_mutex);
+		if (self->compress_dict != NULL) {
+			rc = ZSTD_compress_usingDict(
+				self->zstd_cctx, pOut + 1, (size_t) (*pnOut - 1), pIn, nIn,
+				self->compress_dict, self->compress_dict_len,
+				self->compress_level
+			);
+		} else {
+			rc = ZSTD_compressCCtx(
+				self->zstd_cctx, pOut + 1, (size_t) (*pnOut - 1), pIn, nIn,
+				self->compress_level
+			);
+		}
+		self->lsm_env->xMutexLeave(self->zstd_mutex);
+
+		nOut = ZSTD_isError(rc) ? 0 : (int) rc;
+	} else {
+		nOut = LZ4_compress_fast(
+			pIn, pOut + 1, nIn, *pnOut - 1,
+			__atomic_load_n(&self->lz4_acceleration, __ATOMIC_RELAXED)
+		);
+	}
+
+	// Pages that do not shrink — already-compressed values, random data
+	// — are stored verbatim behind the flag byte, so neither this write
+	// nor any later read pays the codec for them.
+	if (nOut <= 0 || nOut >= nIn) {
+		pOut[0] = PYLSM_ADAPTIVE_RAW;
+		memcpy(pOut + 1, pIn, nIn);
+		*pnOut = nIn + 1;
+		PYLSM_STAT_ADD(self, stat_pages_raw, 1);
+	} else {
+		pOut[0] = PYLSM_ADAPTIVE_COMPRESSED;
+		*pnOut = nOut + 1;
+		PYLSM_STAT_ADD(self, stat_pages_compressed, 1);
+	}
+
+	pylsm_adaptive_account(self, nIn, *pnOut);
+	return LSM_OK;
+}
+
+
+static int pylsm_adaptive_xUncompress(LSM* self, char *pOut, int *pnOut, const char *pIn, int nIn) {
+	if (nIn < 1) return LSM_CORRUPT;
+
+	if (pIn[0] == PYLSM_ADAPTIVE_RAW) {
+		if (nIn - 1 > *pnOut) return LSM_CORRUPT;
+		memcpy(pOut, pIn + 1, nIn - 1);
+		*pnOut = nIn - 1;
+		return LSM_OK;
+	}
+
+	if (self->lsm_compress.iId == PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE) {
+		Py_ssize_t nDecoded = *pnOut;
+		int rc = pylsm_zstd_xUncompress(
+			self, pOut, &nDecoded, pIn + 1, nIn - 1
+		);
+		*pnOut = (int) nDecoded;
+		return rc;
+	}
+	return pylsm_lz4_xUncompress(self, pOut, pnOut, pIn + 1, nIn - 1);
+}
+
+
 static uint32_t is_power_of_two(uint32_t n) {
    if (n==0) return 0;
    return (ceil(log2(n)) == floor(log2(n)));
@@ -254,6 +896,37 @@ static void pylsm_logger(LSM* self, int rc, const char * message) {
 }
 
 
+// Engine log callback for logger_buffered=True. Never touches the GIL:
+// the message is copied into a fixed ring and handed to the Python
+// logger later by drain_logs(). A full ring drops the message and bumps
+// a counter instead of stalling lsm_work().
+static void pylsm_logger_buffered(LSM* self, int rc, const char * message) {
+	unsigned long long head, tail;
+	LSMLogEntry *entry;
+
+	for (;;) {
+		head = __atomic_load_n(&self->log_head, __ATOMIC_ACQUIRE);
+		tail = __atomic_load_n(&self->log_tail, __ATOMIC_RELAXED);
+
+		if (head - tail >= PYLSM_LOG_RING_SIZE) {
+			PYLSM_STAT_ADD(self, log_dropped, 1);
+			return;
+		}
+
+		if (__atomic_compare_exchange_n(
+			&self->log_head, &head, head + 1, 0,
+			__ATOMIC_ACQ_REL, __ATOMIC_RELAXED
+		)) break;
+	}
+
+	entry = &self->log_ring[head % PYLSM_LOG_RING_SIZE];
+	entry->rc = rc;
+	strncpy(entry->message, message, PYLSM_LOG_MSG_MAX - 1);
+	entry->message[PYLSM_LOG_MSG_MAX - 1] = '\0';
+	__atomic_store_n(&entry->ready, 1, __ATOMIC_RELEASE);
+}
+
+
 static int pylsm_seek_mode_check(int seek_mode) {
 	switch (seek_mode) {
 		case LSM_SEEK_EQ:
@@ -291,55 +964,181 @@ static Py_ssize_t pylsm_csr_length(lsm_cursor* cursor, Py_ssize_t *result) {
 }
 
 
-static Py_ssize_t pylsm_length(lsm_db* lsm, Py_ssize_t *result) {
+static Py_ssize_t pylsm_length(LSM* self, Py_ssize_t *result) {
 	Py_ssize_t rc = 0;
 	lsm_cursor *cursor;
 
-	if ((rc = lsm_csr_open(lsm, &cursor))) return rc;
+	if ((rc = pylsm_csr_open_shared(self, &cursor))) return rc;
 	rc = pylsm_csr_length(cursor, result);
-	lsm_csr_close(cursor);
+	pylsm_csr_close_shared(self, cursor);
+	return rc;
+}
+
+
+// 64-bit FNV-1a over the key; the second probe stride is derived from
+// the first hash with a murmur-style finisher, so one pass over the key
+// yields the whole double-hashing sequence.
+static void pylsm_bloom_hash(
+	const char *pKey, int nKey, uint64_t *h1, uint64_t *h2
+) {
+	uint64_t h = 14695981039346656037ULL;
+	int i;
+
+	for (i = 0; i < nKey; i++) {
+		h ^= (uint64_t)(unsigned char) pKey[i];
+		h *= 1099511628211ULL;
+	}
+
+	*h1 = h;
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	*h2 = h | 1;
+}
+
+
+// Inserts always run under the exclusive lock, so plain bit operations
+// are enough here.
+static void pylsm_bloom_add(LSM* self, const char* pKey, int nKey) {
+	uint64_t h1, h2, bit;
+	int i;
+
+	if (self->bloom == NULL) return;
+
+	pylsm_bloom_hash(pKey, nKey, &h1, &h2);
+	for (i = 0; i < self->bloom_hashes; i++) {
+		bit = (h1 + (uint64_t) i * h2) % self->bloom_nbits;
+		self->bloom[bit >> 3] |= (char)(1 << (bit & 7));
+	}
+}
+
+
+// Returns zero only when the key is certainly not in the store. Deleted
+// keys keep their bits set, which merely costs a wasted seek.
+static int pylsm_bloom_maybe(LSM* self, const char* pKey, int nKey) {
+	uint64_t h1, h2, bit;
+	int i;
+
+	if (self->bloom == NULL) return 1;
+
+	pylsm_bloom_hash(pKey, nKey, &h1, &h2);
+	for (i = 0; i < self->bloom_hashes; i++) {
+		bit = (h1 + (uint64_t) i * h2) % self->bloom_nbits;
+		if (!(self->bloom[bit >> 3] & (1 << (bit & 7)))) return 0;
+	}
+	return 1;
+}
+
+
+// Seeds the filter from the keys already on disk. Sized for twice the
+// current key count so the false-positive rate stays low while the
+// store keeps growing after open. A failed build leaves the filter off
+// rather than risking false negatives from a half-populated bitmap.
+static int pylsm_bloom_build(LSM* self) {
+	lsm_cursor *cursor;
+	const void *pKey;
+	int nKey;
+	int rc;
+	Py_ssize_t count = 0;
+	uint64_t nbits;
+
+	if ((rc = pylsm_csr_open_shared(self, &cursor))) return rc;
+
+	if ((rc = (int) pylsm_csr_length(cursor, &count))) {
+		pylsm_csr_close_shared(self, cursor);
+		return rc;
+	}
+
+	if (count < PYLSM_BLOOM_MIN_KEYS) count = PYLSM_BLOOM_MIN_KEYS;
+	nbits = (uint64_t) count * PYLSM_BLOOM_HEADROOM * self->bloom_bits_per_key;
+
+	self->bloom = calloc((nbits + 7) / 8, sizeof(char));
+	if (self->bloom == NULL) {
+		pylsm_csr_close_shared(self, cursor);
+		return LSM_NOMEM;
+	}
+
+	self->bloom_nbits = nbits;
+	self->bloom_hashes = self->bloom_bits_per_key * 7 / 10;
+	if (self->bloom_hashes < 1) self->bloom_hashes = 1;
+	if (self->bloom_hashes > 16) self->bloom_hashes = 16;
+
+	for (
+		rc = lsm_csr_first(cursor);
+		rc == LSM_OK && lsm_csr_valid(cursor);
+		rc = lsm_csr_next(cursor)
+	) {
+		if ((rc = lsm_csr_key(cursor, &pKey, &nKey))) break;
+		pylsm_bloom_add(self, pKey, nKey);
+	}
+
+	pylsm_csr_close_shared(self, cursor);
+
+	if (rc != LSM_OK) {
+		free(self->bloom);
+		self->bloom = NULL;
+		self->bloom_nbits = 0;
+	}
 	return rc;
 }
 
 
+// Point lookup. The value is copied into a pooled buffer (*ppVal,
+// released by the caller with pylsm_buf_release) while the cursor is
+// positioned; building the Python object happens only after the
+// database lock is dropped, because re-acquiring the GIL with the
+// lock held can deadlock against a GIL-holding thread blocked on it
+// — object deallocation paths take the lock without releasing the
+// GIL first. A SEEK_LEFAST hit succeeds with *ppVal left NULL.
+// Returns -1 when the key is absent.
 static int pylsm_getitem(
-	lsm_db* lsm,
+	LSM* self,
 	const char * pKey,
 	int nKey,
 	char** ppVal,
 	int* pnVal,
+	size_t* pCap,
 	int seek_mode
 ) {
 	int rc;
 	lsm_cursor *cursor;
-	char* pValue = NULL;
+	const char* pValue = NULL;
 	int nValue = 0;
 	char* result = NULL;
 
-	if ((rc = lsm_csr_open(lsm, &cursor))) return rc;
+	PYLSM_STAT_ADD(self, stat_gets, 1);
+
+	if (seek_mode == LSM_SEEK_EQ && !pylsm_bloom_maybe(self, pKey, nKey)) {
+		return -1;
+	}
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
 	if ((rc = lsm_csr_seek(cursor, pKey, nKey, seek_mode))) {
-		lsm_csr_close(cursor);
+		pylsm_csr_release(self, cursor);
 		return rc;
 	}
 	if (!lsm_csr_valid(cursor)) {
-		lsm_csr_close(cursor);
+		pylsm_csr_release(self, cursor);
 		return -1;
 	}
 
 	if (seek_mode == LSM_SEEK_LEFAST) {
 		*pnVal = 0;
-		lsm_csr_close(cursor);
+		pylsm_csr_release(self, cursor);
 		return rc;
 	}
 
-	if ((rc = lsm_csr_value(cursor, (const void **)&pValue, &nValue))) {
-		lsm_csr_close(cursor);
+	if ((rc = lsm_csr_value(cursor, (const void **) &pValue, &nValue))) {
+		pylsm_csr_release(self, cursor);
 		return rc;
 	}
 
-	result = calloc(nValue, sizeof(char));
+	if ((result = pylsm_buf_acquire(self, nValue, pCap)) == NULL) {
+		pylsm_csr_release(self, cursor);
+		return LSM_NOMEM;
+	}
 	memcpy(result, pValue, nValue);
-	lsm_csr_close(cursor);
+	pylsm_csr_release(self, cursor);
 
 	*ppVal = result;
 	*pnVal = nValue;
@@ -347,41 +1146,395 @@ static int pylsm_getitem(
 }
 
 
-static int pylsm_delitem(
-	lsm_db* lsm,
-	const char * pKey,
-	int nKey
+// Point-lookup a batch of pre-sorted keys over a single cursor.
+// nVals[i] is set to -1 for keys that are not present.
+static int pylsm_getmany(
+	LSM* self,
+	const char** pKeys, Py_ssize_t* nKeys, Py_ssize_t count,
+	char** pVals, int* nVals, size_t* capVals
 ) {
 	int rc = 0;
 	lsm_cursor *cursor;
+	const char* pValue = NULL;
+	int nValue = 0;
 
-	if ((rc = lsm_csr_open(lsm, &cursor))) return rc;
-	if ((rc = lsm_csr_seek(cursor, pKey, nKey, LSM_SEEK_EQ))) {
-		lsm_csr_close(cursor);
-		return rc;
+	PYLSM_STAT_ADD(self, stat_gets, count);
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
+
+	for (Py_ssize_t i = 0; i < count; i++) {
+		nVals[i] = -1;
+		if (!pylsm_bloom_maybe(self, pKeys[i], (int) nKeys[i])) continue;
+		if ((rc = lsm_csr_seek(cursor, pKeys[i], (int) nKeys[i], LSM_SEEK_EQ))) break;
+		if (!lsm_csr_valid(cursor)) continue;
+		if ((rc = lsm_csr_value(cursor, (const void **) &pValue, &nValue))) break;
+		if ((pVals[i] = pylsm_buf_acquire(self, nValue, &capVals[i])) == NULL) {
+			rc = LSM_NOMEM;
+			break;
+		}
+		memcpy(pVals[i], pValue, nValue);
+		nVals[i] = nValue;
 	}
-	if (!lsm_csr_valid(cursor)) {
-		lsm_csr_close(cursor);
-		return -1;
+
+	pylsm_csr_release(self, cursor);
+	return rc;
+}
+
+
+static int pylsm_delitem(
+	LSM* self,
+	const char * pKey,
+	int nKey
+) {
+	int rc = 0;
+	lsm_cursor *cursor;
+
+	if (!pylsm_bloom_maybe(self, pKey, nKey)) return -1;
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
+	if ((rc = lsm_csr_seek(cursor, pKey, nKey, LSM_SEEK_EQ))) {
+		lsm_csr_close(cursor);
+		return rc;
+	}
+	if (!lsm_csr_valid(cursor)) {
+		pylsm_csr_release(self, cursor);
+		return -1;
 	}
 	lsm_csr_close(cursor);
-	if ((rc = lsm_delete(lsm, pKey, nKey))) return rc;
+	pylsm_csr_pool_drain(self);
+	if ((rc = lsm_delete(self->lsm, pKey, nKey))) return rc;
+	PYLSM_STAT_ADD(self, stat_deletes, 1);
 	return 0;
 }
 
 
-static int pylsm_contains(lsm_db* lsm, const char* pKey, int nKey) {
+static int pylsm_contains(LSM* self, const char* pKey, int nKey) {
 	int rc;
 	lsm_cursor *cursor;
 
-	if ((rc = lsm_csr_open(lsm, &cursor))) return rc;
+	if (!pylsm_bloom_maybe(self, pKey, nKey)) return -1;
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
 	if ((rc = lsm_csr_seek(cursor, pKey, nKey, LSM_SEEK_EQ))) {
-		lsm_csr_close(cursor);
+		pylsm_csr_close_shared(self, cursor);
 		return rc;
 	}
 
 	if (!lsm_csr_valid(cursor)) { rc = -1; } else { rc = 0; }
-	lsm_csr_close(cursor);
+	pylsm_csr_release(self, cursor);
+	return rc;
+}
+
+
+// Walks [pStart, pStop] counting entries without materializing a single
+// Python object; when nbytes is not NULL the key and value sizes are
+// summed as well. Stop is inclusive, matching slice semantics. Expects
+// the shared lock held and the GIL released.
+static int pylsm_range_scan(
+	LSM* self,
+	const char* pStart, Py_ssize_t nStart,
+	const char* pStop, Py_ssize_t nStop,
+	Py_ssize_t *count, Py_ssize_t *nbytes
+) {
+	lsm_cursor *cursor;
+	const void *pKey;
+	const void *pVal;
+	int nKey, nVal;
+	int rc;
+
+	if ((rc = pylsm_csr_open_shared(self, &cursor))) return rc;
+
+	for (
+		rc = lsm_csr_seek(cursor, pStart, (int) nStart, LSM_SEEK_GE);
+		rc == LSM_OK && lsm_csr_valid(cursor);
+		rc = lsm_csr_next(cursor)
+	) {
+		if ((rc = lsm_csr_key(cursor, &pKey, &nKey))) break;
+
+		Py_ssize_t n = nKey < nStop ? nKey : nStop;
+		int cmp = memcmp(pKey, pStop, n);
+		if (cmp > 0 || (cmp == 0 && nKey > nStop)) break;
+
+		(*count)++;
+
+		if (nbytes != NULL) {
+			if ((rc = lsm_csr_value(cursor, &pVal, &nVal))) break;
+			*nbytes += nKey + nVal;
+		}
+	}
+
+	pylsm_csr_close_shared(self, cursor);
+	return rc;
+}
+
+
+// Build the Python object for a stored key in any of the three key
+// modes. Int-mode keys are always PYLSM_INT_KEY_SIZE bytes; anything
+// else (a file written in another mode) falls back to bytes rather
+// than decoding garbage.
+static PyObject* pylsm_key_materialize(
+	const char* pKey, int nKey, uint8_t binary
+) {
+	if (binary == PY_LSM_KEY_INT && nKey == PYLSM_INT_KEY_SIZE) {
+		unsigned long long value = 0;
+		for (int i = 0; i < PYLSM_INT_KEY_SIZE; i++) {
+			value = (value << 8) | (unsigned char) pKey[i];
+		}
+		return PyLong_FromUnsignedLongLong(value);
+	}
+	if (binary) return PyBytes_FromStringAndSize(pKey, nKey);
+	return PyUnicode_FromStringAndSize(pKey, nKey);
+}
+
+
+static void pylsm_items_free(LSMPrefetchItem *items, Py_ssize_t count) {
+	if (items == NULL) return;
+
+	for (Py_ssize_t i = 0; i < count; i++) {
+		if (items[i].pKey != NULL) free(items[i].pKey);
+		if (items[i].pVal != NULL) free(items[i].pVal);
+	}
+	free(items);
+}
+
+
+// Turn a collected batch into a list of (key, value) tuples, consuming
+// the batch either way.
+static PyObject* pylsm_items_to_list(
+	LSMPrefetchItem *items, Py_ssize_t count, uint8_t binary
+) {
+	PyObject *result = PyList_New(count);
+	if (result == NULL) {
+		pylsm_items_free(items, count);
+		return NULL;
+	}
+
+	for (Py_ssize_t i = 0; i < count; i++) {
+		PyObject *key, *value, *pair;
+
+		key = pylsm_key_materialize(items[i].pKey, (int) items[i].nKey, binary);
+		if (binary) {
+			value = PyBytes_FromStringAndSize(items[i].pVal, items[i].nVal);
+		} else {
+			value = PyUnicode_FromStringAndSize(items[i].pVal, items[i].nVal);
+		}
+
+		if (key == NULL || value == NULL) {
+			Py_XDECREF(key);
+			Py_XDECREF(value);
+			Py_DECREF(result);
+			pylsm_items_free(items, count);
+			return NULL;
+		}
+
+		pair = PyTuple_Pack(2, key, value);
+		Py_DECREF(key);
+		Py_DECREF(value);
+
+		if (pair == NULL) {
+			Py_DECREF(result);
+			pylsm_items_free(items, count);
+			return NULL;
+		}
+		PyList_SET_ITEM(result, i, pair);
+	}
+
+	pylsm_items_free(items, count);
+	return result;
+}
+
+
+// Seek plus copy out up to limit entries of the inclusive [start, stop]
+// range in one pass; limit below zero means the whole range. Expects
+// the shared lock held and the GIL released, so a paginated range read
+// pays for one lock window instead of one per row. The caller owns the
+// returned batch.
+static int pylsm_read_range_collect(
+	LSM* self,
+	const char* pStart, Py_ssize_t nStart,
+	const char* pStop, Py_ssize_t nStop,
+	Py_ssize_t limit,
+	LSMPrefetchItem **pItems, Py_ssize_t *pCount
+) {
+	lsm_cursor *cursor;
+	LSMPrefetchItem *items = NULL;
+	LSMPrefetchItem *item;
+	Py_ssize_t count = 0, cap = 0;
+	const void *pKey;
+	const void *pVal;
+	int nKey, nVal;
+	int rc;
+
+	*pItems = NULL;
+	*pCount = 0;
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
+
+	for (
+		rc = lsm_csr_seek(cursor, pStart, (int) nStart, LSM_SEEK_GE);
+		rc == LSM_OK && lsm_csr_valid(cursor);
+		rc = lsm_csr_next(cursor)
+	) {
+		if (limit >= 0 && count >= limit) break;
+		if ((rc = lsm_csr_key(cursor, &pKey, &nKey))) break;
+
+		Py_ssize_t n = nKey < nStop ? nKey : nStop;
+		int cmp = memcmp(pKey, pStop, n);
+		if (cmp > 0 || (cmp == 0 && nKey > nStop)) break;
+
+		if ((rc = lsm_csr_value(cursor, &pVal, &nVal))) break;
+
+		if (count >= cap) {
+			Py_ssize_t next_cap = cap > 0 ? cap * 2 : 64;
+			if (limit >= 0 && next_cap > limit) next_cap = limit;
+
+			item = realloc(items, next_cap * sizeof(LSMPrefetchItem));
+			if (item == NULL) { rc = LSM_NOMEM; break; }
+			items = item;
+			cap = next_cap;
+		}
+
+		item = &items[count];
+		memset(item, 0, sizeof(LSMPrefetchItem));
+
+		if ((item->pKey = calloc(nKey + 1, sizeof(char))) == NULL) {
+			rc = LSM_NOMEM;
+			break;
+		}
+		memcpy(item->pKey, pKey, nKey);
+		item->nKey = nKey;
+
+		if ((item->pVal = calloc(nVal + 1, sizeof(char))) == NULL) {
+			free(item->pKey);
+			rc = LSM_NOMEM;
+			break;
+		}
+		memcpy(item->pVal, pVal, nVal);
+		item->nVal = nVal;
+
+		count++;
+	}
+
+	pylsm_csr_release(self, cursor);
+
+	if (rc != LSM_OK) {
+		pylsm_items_free(items, count);
+		return rc;
+	}
+
+	*pItems = items;
+	*pCount = count;
+	return LSM_OK;
+}
+
+
+static Py_ssize_t pylsm_length_cached(LSM* self, Py_ssize_t *result) {
+	Py_ssize_t rc = LSM_OK;
+	Py_ssize_t count = 0;
+
+	if (!self->key_count_valid) {
+		if ((rc = pylsm_length(self, &count))) return rc;
+		pylsm_pool_lock(self);
+		self->key_count = count;
+		self->key_count_valid = 1;
+		pylsm_pool_unlock(self);
+	}
+
+	*result = (Py_ssize_t) self->key_count;
+	return rc;
+}
+
+
+// Insert keeping self->key_count in sync. The existence probe is only
+// paid once the counter has been materialized by count() or len().
+static int pylsm_insert_tracked(
+	LSM* self,
+	const char* pKey, int nKey,
+	const char* pVal, int nVal
+) {
+	int rc;
+	int exists = 0;
+
+	if (self->key_count_valid) {
+		rc = pylsm_contains(self, pKey, nKey);
+		if (rc == 0) { exists = 1; } else if (rc != -1) return rc;
+	}
+
+	pylsm_csr_pool_drain(self);
+	if ((rc = lsm_insert(self->lsm, pKey, nKey, pVal, nVal))) return rc;
+	pylsm_bloom_add(self, pKey, nKey);
+	if (self->key_count_valid && !exists) self->key_count++;
+	PYLSM_STAT_ADD(self, stat_inserts, 1);
+	return LSM_OK;
+}
+
+
+static int pylsm_delete_tracked(LSM* self, const char* pKey, int nKey) {
+	int rc;
+	int exists = 0;
+
+	if (self->key_count_valid) {
+		rc = pylsm_contains(self, pKey, nKey);
+		if (rc == 0) { exists = 1; } else if (rc != -1) return rc;
+	}
+
+	pylsm_csr_pool_drain(self);
+	if ((rc = lsm_delete(self->lsm, pKey, nKey))) return rc;
+	if (self->key_count_valid && exists) self->key_count--;
+	PYLSM_STAT_ADD(self, stat_deletes, 1);
+	return LSM_OK;
+}
+
+
+static void pylsm_batch_free_ops(LSMBatchOp* ops, Py_ssize_t count) {
+	Py_ssize_t i;
+	for (i = 0; i < count; i++) {
+		if (ops[i].pKey != NULL) free(ops[i].pKey);
+		if (ops[i].pVal != NULL) free(ops[i].pVal);
+	}
+}
+
+
+// Apply a buffered run of inserts and deletes in one nested
+// transaction. Expects the write lock held and the GIL released; the
+// whole run costs a single lock acquisition instead of one per key.
+static int pylsm_batch_apply(LSM* self, LSMBatchOp* ops, Py_ssize_t count) {
+	int rc;
+	Py_ssize_t i;
+
+	long long inserts = 0;
+	long long deletes = 0;
+
+	if ((rc = lsm_begin(self->lsm, self->tx_level + 1))) return rc;
+	pylsm_csr_pool_drain(self);
+
+	for (i = 0; i < count; i++) {
+		if (ops[i].pVal != NULL) {
+			rc = lsm_insert(
+				self->lsm,
+				ops[i].pKey, ops[i].nKey,
+				ops[i].pVal, ops[i].nVal
+			);
+			pylsm_bloom_add(self, ops[i].pKey, ops[i].nKey);
+			inserts++;
+		} else {
+			rc = lsm_delete(self->lsm, ops[i].pKey, ops[i].nKey);
+			deletes++;
+		}
+		if (rc != LSM_OK) break;
+	}
+
+	PYLSM_STAT_ADD(self, stat_inserts, inserts);
+	PYLSM_STAT_ADD(self, stat_deletes, deletes);
+
+	if (rc == LSM_OK) {
+		rc = lsm_commit(self->lsm, self->tx_level);
+	} else {
+		lsm_rollback(self->lsm, self->tx_level);
+	}
+
+	// No per-key existence probes here, so the cached counter is stale.
+	self->key_count_valid = 0;
 	return rc;
 }
 
@@ -391,7 +1544,7 @@ static int pylsm_ensure_opened(LSM* self) {
 		PyErr_SetString(PyExc_MemoryError, "Instance deallocated");
 		return -1;
 	}
-	if (self->state == PY_LSM_OPENED) return 0;
+	if (PYLSM_FIELD_GET(self, state) == PY_LSM_OPENED) return 0;
 
 	PyErr_SetString(PyExc_RuntimeError, "Database has not opened");
 	return -1;
@@ -421,27 +1574,57 @@ static int pylsm_ensure_csr_opened(LSMCursor* self) {
 }
 
 
+// lsm1 orders keys by memcmp, so the stop bound can be checked against
+// the raw key bytes instead of paying a lsm_csr_cmp call per entry.
+static int pylsm_slice_stop_cmp(LSMSliceView* self, int* cmp_res) {
+	int rc;
+	const char* pKey = NULL;
+	int nKey = 0;
+	int cmp;
+
+	if ((rc = lsm_csr_key(self->cursor, (const void**) &pKey, &nKey))) return rc;
+
+	cmp = memcmp(
+		pKey, self->pStop,
+		(nKey < self->nStop) ? (size_t) nKey : (size_t) self->nStop
+	);
+	if (cmp == 0) cmp = (nKey > self->nStop) - (nKey < self->nStop);
+
+	*cmp_res = cmp;
+	return LSM_OK;
+}
+
+
 int pylsm_slice_first(LSMSliceView* self) {
 	int rc;
 	int cmp_res;
 
+	if (!lsm_csr_valid(self->cursor)) return -1;
+
 	if (self->pStop != NULL) {
-		if ((rc = lsm_csr_cmp(self->cursor, self->pStop, (int) self->nStop, &cmp_res))) return rc;
+		if ((rc = pylsm_slice_stop_cmp(self, &cmp_res))) return rc;
 		if (self->direction == PY_LSM_SLICE_FORWARD && cmp_res > 0) return -1;
 		if (self->direction == PY_LSM_SLICE_BACKWARD && cmp_res < 0) return -1;
 	}
 
-	if (!lsm_csr_valid(self->cursor)) return -1;
-
 	return 0;
 }
 
 
+// Advance a whole step in one burst and only then test the stop bound:
+// entries skipped over are never yielded, so comparing at the landing
+// position alone is enough. The engine has no ordinal seek, so large
+// steps still walk the intermediate entries, but without per-entry
+// bound checks.
 int pylsm_slice_next(LSMSliceView* self) {
 	int rc;
-	int cmp_res = -65535;
+	int cmp_res;
+	long step = (self->step < 0) ? -self->step : self->step;
+	long i;
 
-	while (lsm_csr_valid(self->cursor)) {
+	if (!lsm_csr_valid(self->cursor)) return -1;
+
+	for (i = 0; i < step; i++) {
 		switch (self->direction) {
 			case PY_LSM_SLICE_FORWARD:
 				if ((rc = lsm_csr_next(self->cursor))) return rc;
@@ -451,19 +1634,16 @@ int pylsm_slice_next(LSMSliceView* self) {
 				break;
 		}
 
-		if (!lsm_csr_valid(self->cursor)) break;
-
-		if (self->pStop != NULL) {
-			if ((rc = lsm_csr_cmp(self->cursor, self->pStop, (int) self->nStop, &cmp_res))) return rc;
-			if (self->direction == PY_LSM_SLICE_FORWARD && cmp_res > 0) break;
-			if (self->direction == PY_LSM_SLICE_BACKWARD && cmp_res < 0) break;
-		}
+		if (!lsm_csr_valid(self->cursor)) return -1;
+	}
 
-		self->counter++;
-		if ((self->counter % self->step) == 0) return 0;
+	if (self->pStop != NULL) {
+		if ((rc = pylsm_slice_stop_cmp(self, &cmp_res))) return rc;
+		if (self->direction == PY_LSM_SLICE_FORWARD && cmp_res > 0) return -1;
+		if (self->direction == PY_LSM_SLICE_BACKWARD && cmp_res < 0) return -1;
 	}
 
-	return -1;
+	return 0;
 }
 
 
@@ -475,7 +1655,7 @@ static inline int pylsm_seek_mode_direction(int direction) {
 static int pylsm_slice_view_iter(LSMSliceView *self) {
 	int rc;
 
-	if ((rc = lsm_csr_open(self->db->lsm, &self->cursor))) return rc;
+	if ((rc = pylsm_csr_open_shared(self->db, &self->cursor))) return rc;
 
 	int seek_mode = pylsm_seek_mode_direction(self->direction);
 
@@ -525,30 +1705,57 @@ static int str_or_bytes_check(char binary, PyObject* pObj, const char** ppBuff,
 }
 
 
+// Key conversion covering all three key modes. In int mode the key is
+// packed into the caller's PYLSM_INT_KEY_SIZE-byte buffer — stack
+// space on the hot paths, so point operations allocate nothing.
+static int pylsm_key_check(
+	char binary, PyObject* pObj,
+	const char** ppBuff, Py_ssize_t* nBuf, char* pPacked
+) {
+	if (binary == PY_LSM_KEY_INT) {
+		unsigned long long value;
+
+		if (!PyLong_Check(pObj)) {
+			PyErr_Format(
+				PyExc_ValueError, "int expected not %R", PyObject_Type(pObj)
+			);
+			return -1;
+		}
+
+		value = PyLong_AsUnsignedLongLong(pObj);
+		if (value == (unsigned long long) -1 && PyErr_Occurred()) return -1;
+
+		for (int i = PYLSM_INT_KEY_SIZE - 1; i >= 0; i--) {
+			pPacked[i] = (char) (value & 0xff);
+			value >>= 8;
+		}
+
+		*ppBuff = pPacked;
+		*nBuf = PYLSM_INT_KEY_SIZE;
+		return 0;
+	}
+
+	return str_or_bytes_check(binary, pObj, ppBuff, nBuf);
+}
+
+
+// Key-only fetch: never touches the value, which with compression
+// enabled may be the difference between reading a header and
+// decompressing a whole page run.
 static PyObject* pylsm_cursor_key_fetch(lsm_cursor* cursor, uint8_t binary) {
 	char *pKey = NULL;
 	int nKey = 0;
-	char *pValue = NULL;
-	int nValue = 0;
 
 	if (pylsm_error(lsm_csr_key(cursor, (const void**) &pKey, &nKey))) return NULL;
-	if (pylsm_error(lsm_csr_value(cursor, (const void**) &pValue, &nValue))) return NULL;
 
-	if (binary) {
-		return PyBytes_FromStringAndSize(pKey, nKey);
-	} else {
-		return PyUnicode_FromStringAndSize(pKey, nKey);
-	}
+	return pylsm_key_materialize(pKey, nKey, binary);
 }
 
 
 static PyObject* pylsm_cursor_value_fetch(lsm_cursor* cursor, uint8_t binary) {
-	char *pKey = NULL;
-	int nKey = 0;
 	char *pValue = NULL;
 	int nValue = 0;
 
-	if (pylsm_error(lsm_csr_key(cursor, (const void**) &pKey, &nKey))) return NULL;
 	if (pylsm_error(lsm_csr_value(cursor, (const void**) &pValue, &nValue))) return NULL;
 
 	if (binary) {
@@ -571,11 +1778,10 @@ static PyObject* pylsm_cursor_items_fetch(lsm_cursor* cursor, uint8_t binary) {
 	PyObject* pyKey;
 	PyObject* pyValue;
 
+	pyKey = pylsm_key_materialize(pKey, nKey, binary);
 	if (binary) {
-		pyKey = PyBytes_FromStringAndSize(pKey, nKey);
 		pyValue = PyBytes_FromStringAndSize(pValue, nValue);
 	} else {
-		pyKey = PyUnicode_FromStringAndSize(pKey, nKey);
 		pyValue = PyUnicode_FromStringAndSize(pValue, nValue);
 	}
 
@@ -593,14 +1799,122 @@ static PyObject* LSMIterView_new(PyTypeObject *type) {
 }
 
 
+// Copy up to prefetch_cap entries out of the cursor in one go. Expects
+// the shared lock held and the GIL released; the caller only pays lock
+// and GIL churn once per batch instead of once per __next__ call.
+// Cursors pin their snapshot, so batching does not change what an
+// iterator observes.
+static int pylsm_iterview_refill(
+	LSMIterView *self, int prefetch_cap, int want_keys, int want_values
+) {
+	int rc = LSM_OK;
+	const char *pKey; int nKey;
+	const char *pVal; int nVal;
+	LSMPrefetchItem *item;
+
+	self->prefetch_pos = 0;
+	self->prefetch_used = 0;
+
+	while (self->prefetch_used < prefetch_cap && lsm_csr_valid(self->cursor)) {
+		item = &self->prefetch[self->prefetch_used];
+		memset(item, 0, sizeof(LSMPrefetchItem));
+
+		if (want_keys) {
+			if ((rc = lsm_csr_key(self->cursor, (const void **) &pKey, &nKey))) return rc;
+			if ((item->pKey = calloc(nKey + 1, sizeof(char))) == NULL) return LSM_NOMEM;
+			memcpy(item->pKey, pKey, nKey);
+			item->nKey = nKey;
+		}
+
+		if (want_values) {
+			if ((rc = lsm_csr_value(self->cursor, (const void **) &pVal, &nVal))) return rc;
+			if ((item->pVal = calloc(nVal + 1, sizeof(char))) == NULL) return LSM_NOMEM;
+			memcpy(item->pVal, pVal, nVal);
+			item->nVal = nVal;
+		}
+
+		self->prefetch_used++;
+		if ((rc = lsm_csr_next(self->cursor))) return rc;
+	}
+
+	if (!lsm_csr_valid(self->cursor)) self->exhausted = 1;
+	return LSM_OK;
+}
+
+
+static void pylsm_iterview_drop_prefetch(LSMIterView *self) {
+	if (self->prefetch == NULL) return;
+
+	while (self->prefetch_pos < self->prefetch_used) {
+		LSMPrefetchItem *item = &self->prefetch[self->prefetch_pos++];
+		if (item->pKey != NULL) free(item->pKey);
+		if (item->pVal != NULL) free(item->pVal);
+	}
+
+	free(self->prefetch);
+	self->prefetch = NULL;
+	self->prefetch_used = 0;
+	self->prefetch_pos = 0;
+}
+
+
+// Serve the next buffered entry, refilling when the buffer runs dry.
+// Returns NULL with StopIteration or the engine error set.
+static LSMPrefetchItem* pylsm_iterview_next_item(
+	LSMIterView *self, int want_keys, int want_values
+) {
+	if (self->prefetch_pos >= self->prefetch_used) {
+		int prefetch_cap = self->db->iter_prefetch;
+		if (prefetch_cap < 1) prefetch_cap = 1;
+		if (prefetch_cap > PYLSM_ITER_PREFETCH_MAX) prefetch_cap = PYLSM_ITER_PREFETCH_MAX;
+
+		if (self->exhausted) {
+			self->state = PY_LSM_CLOSED;
+			PyErr_SetNone(PyExc_StopIteration);
+			return NULL;
+		}
+
+		if (self->prefetch == NULL) {
+			self->prefetch = calloc(prefetch_cap, sizeof(LSMPrefetchItem));
+			if (self->prefetch == NULL) {
+				PyErr_NoMemory();
+				return NULL;
+			}
+			self->prefetch_cap = prefetch_cap;
+		}
+
+		int rc;
+		Py_BEGIN_ALLOW_THREADS
+		LSM_ReadLock(self->db);
+		rc = pylsm_iterview_refill(
+			self, self->prefetch_cap, want_keys, want_values
+		);
+		LSM_ReadUnlock(self->db);
+		Py_END_ALLOW_THREADS
+
+		if (pylsm_error(rc)) return NULL;
+
+		if (self->prefetch_used == 0) {
+			self->state = PY_LSM_CLOSED;
+			PyErr_SetNone(PyExc_StopIteration);
+			return NULL;
+		}
+	}
+
+	return &self->prefetch[self->prefetch_pos++];
+}
+
+
 static void LSMIterView_dealloc(LSMIterView *self) {
 	if (self->db == NULL) return;
 
+	pylsm_iterview_drop_prefetch(self);
+
 	if (self->cursor != NULL) {
 		Py_BEGIN_ALLOW_THREADS
-		LSM_MutexLock(self->db);
-		lsm_csr_close(self->cursor);
-		LSM_MutexLeave(self->db);
+		LSM_ReadLock(self->db);
+		pylsm_csr_close_shared(self->db, self->cursor);
+		LSM_ReadUnlock(self->db);
 		Py_END_ALLOW_THREADS
 	}
 
@@ -623,6 +1937,12 @@ static int LSMIterView_init(LSMIterView *self, LSM* lsm) {
 	self->db = lsm;
 	Py_INCREF(self->db);
 
+	self->prefetch = NULL;
+	self->prefetch_cap = 0;
+	self->prefetch_used = 0;
+	self->prefetch_pos = 0;
+	self->exhausted = 0;
+
 	self->state = PY_LSM_INITIALIZED;
 	return 0;
 }
@@ -635,9 +1955,9 @@ static Py_ssize_t LSMIterView_len(LSMIterView* self) {
 	Py_ssize_t rc = 0;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
-	rc = pylsm_length(self->db->lsm, &result);
-	LSM_MutexLeave(self->db);
+	LSM_ReadLock(self->db);
+	rc = pylsm_length_cached(self->db, &result);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(rc)) return -1;
@@ -659,18 +1979,18 @@ static LSMIterView* LSMIterView_iter(LSMIterView* self) {
 
 	self->state = PY_LSM_OPENED;
 
-	LSM_MutexLock(self->db);
-	if (pylsm_error(lsm_csr_open(self->db->lsm, &self->cursor))) {
-		LSM_MutexLeave(self->db);
+	LSM_ReadLock(self->db);
+	if (pylsm_error(pylsm_csr_open_shared(self->db, &self->cursor))) {
+		LSM_ReadUnlock(self->db);
 	    return NULL;
 	}
 
 	if (pylsm_error(lsm_csr_first(self->cursor))) {
-		LSM_MutexLeave(self->db);
+		LSM_ReadUnlock(self->db);
 		return NULL;
 	}
 
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 
 	Py_INCREF(self);
 	return self;
@@ -679,94 +1999,95 @@ static LSMIterView* LSMIterView_iter(LSMIterView* self) {
 
 static PyObject* LSMKeysView_next(LSMIterView *self) {
 	if (pylsm_ensure_opened(self->db)) return NULL;
+	if (self->state == PY_LSM_CLOSED) {
+		PyErr_SetNone(PyExc_StopIteration);
+		return NULL;
+	}
 	if (self->state != PY_LSM_OPENED) {
 		PyErr_SetString(PyExc_RuntimeError, "Must call __iter__ before __next__");
 		return NULL;
 	}
 
-	if (!lsm_csr_valid(self->cursor)) {
-		if (self->state != PY_LSM_CLOSED) {
-			self->state = PY_LSM_CLOSED;
-		}
+	LSMPrefetchItem* item = pylsm_iterview_next_item(self, 1, 0);
+	if (item == NULL) return NULL;
+
+	PyObject* result = pylsm_key_materialize(
+		item->pKey, (int) item->nKey, self->db->binary
+	);
+
+	free(item->pKey);
+	item->pKey = NULL;
+	return result;
+}
 
+
+static PyObject* LSMValuesView_next(LSMIterView *self) {
+	if (pylsm_ensure_opened(self->db)) return NULL;
+	if (self->state == PY_LSM_CLOSED) {
 		PyErr_SetNone(PyExc_StopIteration);
 		return NULL;
 	}
-
-	LSM_MutexLock(self->db);
-	PyObject* result = pylsm_cursor_key_fetch(self->cursor, self->db->binary);
-
-	if (result == NULL) {
-		LSM_MutexLeave(self->db);
+	if (self->state != PY_LSM_OPENED) {
+		PyErr_SetString(PyExc_RuntimeError, "Must call __iter__ before __next__");
 		return NULL;
 	}
 
-	if (pylsm_error(lsm_csr_next(self->cursor))) {
-		LSM_MutexLeave(self->db);
-		return NULL;
-	};
+	LSMPrefetchItem* item = pylsm_iterview_next_item(self, 0, 1);
+	if (item == NULL) return NULL;
 
-	LSM_MutexLeave(self->db);
+	PyObject* result;
+	if (self->db->binary) {
+		result = PyBytes_FromStringAndSize(item->pVal, item->nVal);
+	} else {
+		result = PyUnicode_FromStringAndSize(item->pVal, item->nVal);
+	}
+
+	free(item->pVal);
+	item->pVal = NULL;
 	return result;
 }
 
 
-static PyObject* LSMValuesView_next(LSMIterView *self) {
+static PyObject* LSMItemsView_next(LSMIterView *self) {
 	if (pylsm_ensure_opened(self->db)) return NULL;
-
-	if (!lsm_csr_valid(self->cursor)) {
-		if (self->state != PY_LSM_CLOSED) {
-			self->state = PY_LSM_CLOSED;
-		}
+	if (self->state == PY_LSM_CLOSED) {
 		PyErr_SetNone(PyExc_StopIteration);
 		return NULL;
 	}
-
-	LSM_MutexLock(self->db);
-	PyObject* result = pylsm_cursor_value_fetch(self->cursor, self->db->binary);
-	if (result == NULL) {
-		LSM_MutexLeave(self->db);
+	if (self->state != PY_LSM_OPENED) {
+		PyErr_SetString(PyExc_RuntimeError, "Must call __iter__ before __next__");
 		return NULL;
 	}
 
-	if (pylsm_error(lsm_csr_next(self->cursor))) {
-		LSM_MutexLeave(self->db);
-		return NULL;
-	};
-
-	LSM_MutexLeave(self->db);
-
-	return result;
-}
-
-
-static PyObject* LSMItemsView_next(LSMIterView *self) {
-	if (pylsm_ensure_opened(self->db)) return NULL;
+	LSMPrefetchItem* item = pylsm_iterview_next_item(self, 1, 1);
+	if (item == NULL) return NULL;
 
-	if (!lsm_csr_valid(self->cursor)) {
-		if (self->state != PY_LSM_CLOSED) {
-			self->state = PY_LSM_CLOSED;
-		}
-		PyErr_SetNone(PyExc_StopIteration);
-		return NULL;
-	}
+	PyObject* pyKey;
+	PyObject* pyValue;
 
-	LSM_MutexLock(self->db);
-	PyObject* result = pylsm_cursor_items_fetch(
-		self->cursor,
-		self->db->binary
+	pyKey = pylsm_key_materialize(
+		item->pKey, (int) item->nKey, self->db->binary
 	);
-	if (result == NULL) {
-		LSM_MutexLeave(self->db);
-		return NULL;
+	if (self->db->binary) {
+		pyValue = PyBytes_FromStringAndSize(item->pVal, item->nVal);
+	} else {
+		pyValue = PyUnicode_FromStringAndSize(item->pVal, item->nVal);
 	}
 
-	if (pylsm_error(lsm_csr_next(self->cursor))) {
-		LSM_MutexLeave(self->db);
+	free(item->pKey);
+	free(item->pVal);
+	item->pKey = NULL;
+	item->pVal = NULL;
+
+	if (pyKey == NULL || pyValue == NULL) {
+		Py_XDECREF(pyKey);
+		Py_XDECREF(pyValue);
 		return NULL;
-	};
+	}
 
-	LSM_MutexLeave(self->db);
+	PyObject* result = PyTuple_Pack(2, pyKey, pyValue);
+	Py_DECREF(pyKey);
+	Py_DECREF(pyValue);
 	return result;
 }
 
@@ -847,9 +2168,9 @@ static void LSMSliceView_dealloc(LSMSliceView *self) {
 	if (self->db == NULL) return;
 
 	if (self->cursor != NULL) {
-		LSM_MutexLock(self->db);
-		lsm_csr_close(self->cursor);
-		LSM_MutexLeave(self->db);
+		LSM_ReadLock(self->db);
+		pylsm_csr_close_shared(self->db, self->cursor);
+		LSM_ReadUnlock(self->db);
 	}
 
 	if (self->start != NULL) Py_DECREF(self->start);
@@ -908,15 +2229,14 @@ static int LSMSliceView_init(
 
 	self->pStop = NULL;
 	self->nStop = 0;
-	self->counter = 0;
 
 	if (self->stop != Py_None) {
-		if (str_or_bytes_check(self->db->binary, self->stop, (const char **) &self->pStop, &self->nStop)) return -1;
+		if (pylsm_key_check(self->db->binary, self->stop, (const char **) &self->pStop, &self->nStop, self->packed_stop)) return -1;
 		Py_INCREF(self->stop);
 	}
 
 	if (self->start != Py_None) {
-		if (str_or_bytes_check(self->db->binary, self->start, (const char **) &self->pStart, &self->nStart)) return -1;
+		if (pylsm_key_check(self->db->binary, self->start, (const char **) &self->pStart, &self->nStart, self->packed_start)) return -1;
 		Py_INCREF(self->start);
 	}
 
@@ -944,9 +2264,9 @@ static LSMSliceView* LSMSliceView_iter(LSMSliceView* self) {
 
 	int err;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	err = pylsm_slice_view_iter(self);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(err)) return NULL;
@@ -983,7 +2303,7 @@ static PyObject* LSMSliceView_next(LSMSliceView *self) {
 	int rc;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 
 	if (self->state == PY_LSM_OPENED) {
 		self->state = PY_LSM_ITERATING;
@@ -992,7 +2312,7 @@ static PyObject* LSMSliceView_next(LSMSliceView *self) {
 		rc = pylsm_slice_next(self);
 	}
 
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (rc == -1) {
@@ -1013,6 +2333,75 @@ static PyObject* LSMSliceView_next(LSMSliceView *self) {
 }
 
 
+static void pylsm_value_view_detach(LSMValueView *self) {
+	if (self->cursor != NULL) {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_ReadLock(self->db);
+		pylsm_csr_close_shared(self->db, self->cursor);
+		LSM_ReadUnlock(self->db);
+		Py_END_ALLOW_THREADS
+
+		self->cursor = NULL;
+		self->pValue = NULL;
+		self->nValue = 0;
+	}
+}
+
+
+static void LSMValueView_dealloc(LSMValueView *self) {
+	if (self->db == NULL) return;
+
+	pylsm_value_view_detach(self);
+
+	Py_DECREF(self->db);
+	self->db = NULL;
+
+	if (self->weakrefs != NULL) PyObject_ClearWeakRefs((PyObject *) self);
+}
+
+
+static int LSMValueView_getbuffer(LSMValueView *self, Py_buffer *view, int flags) {
+	if (self->cursor == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "Value view released");
+		view->obj = NULL;
+		return -1;
+	}
+
+	if (PyBuffer_FillInfo(
+		view, (PyObject*) self, (void*) self->pValue, self->nValue, 1, flags
+	)) return -1;
+
+	self->exports++;
+	return 0;
+}
+
+
+// The cursor pins the page-cache memory the buffer points into, so it
+// is held open until the last exported buffer is released.
+static void LSMValueView_releasebuffer(LSMValueView *self, Py_buffer *view) {
+	self->exports--;
+	if (self->exports == 0) pylsm_value_view_detach(self);
+}
+
+
+static PyBufferProcs LSMValueView_buffer = {
+	.bf_getbuffer = (getbufferproc) LSMValueView_getbuffer,
+	.bf_releasebuffer = (releasebufferproc) LSMValueView_releasebuffer
+};
+
+
+static PyTypeObject LSMValueViewType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	.tp_name = "lsm_value_view",
+	.tp_basicsize = sizeof(LSMValueView),
+	.tp_itemsize = 0,
+	.tp_flags = Py_TPFLAGS_DEFAULT,
+	.tp_dealloc = (destructor) LSMValueView_dealloc,
+	.tp_as_buffer = &LSMValueView_buffer,
+	.tp_weaklistoffset = offsetof(LSMValueView, weakrefs)
+};
+
+
 static PyTypeObject LSMSliceType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	.tp_name = "lsm_slice",
@@ -1036,14 +2425,22 @@ static PyObject* LSM_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
 static int _LSM_close(LSM* self) {
 	int result;
 
+	if ((result = pylsm_worker_shutdown(self))) return result;
+
 	Py_BEGIN_ALLOW_THREADS;
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
+	pylsm_csr_pool_drain(self);
+	pylsm_buf_pool_drain(self);
 	result = lsm_close(self->lsm);
-	LSM_MutexLeave(self);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS;
 
 	if (result == LSM_OK) {
-		self->state = PY_LSM_CLOSED;
+		if (self->zstd_mutex != NULL) {
+			self->lsm_env->xMutexDel(self->zstd_mutex);
+			self->zstd_mutex = NULL;
+		}
+		PYLSM_FIELD_SET(self, state, PY_LSM_CLOSED);
 		self->lsm = NULL;
 		self->lsm_env = NULL;
 		self->lsm_mutex = NULL;
@@ -1056,6 +2453,20 @@ static int _LSM_close(LSM* self) {
 static void LSM_dealloc(LSM *self) {
 	if (self->state != PY_LSM_CLOSED && self->lsm != NULL) pylsm_error(_LSM_close(self));
 	if (self->lsm_mutex != NULL) self->lsm_env->xMutexDel(self->lsm_mutex);
+	if (self->zstd_mutex != NULL && self->lsm_env != NULL) self->lsm_env->xMutexDel(self->zstd_mutex);
+	if (self->csr_pool != NULL) PyMem_Free(self->csr_pool);
+	while (self->buf_pool_used > 0) free(self->buf_pool[--self->buf_pool_used]);
+	if (self->log_ring != NULL) PyMem_Free(self->log_ring);
+	if (self->bloom != NULL) free(self->bloom);
+#ifdef LSM_MUTEX_PTHREADS
+	pthread_rwlock_destroy(&self->rwlock);
+	pthread_mutex_destroy(&self->pool_mutex);
+	pthread_mutex_destroy(&self->group_mutex);
+	pthread_cond_destroy(&self->group_cond);
+#endif
+	if (self->zstd_cctx != NULL) ZSTD_freeCCtx(self->zstd_cctx);
+	if (self->zstd_dctx != NULL) ZSTD_freeDCtx(self->zstd_dctx);
+	if (self->compress_dict != NULL) PyMem_Free(self->compress_dict);
 	if (self->logger != NULL) Py_DECREF(self->logger);
 	if (self->path != NULL) PyMem_Free(self->path);
 	if (self->weakrefs != NULL) PyObject_ClearWeakRefs((PyObject *) self);
@@ -1073,6 +2484,7 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 	self->multiple_processes = 1;
 	self->page_size = 4 * 1024;
 	self->readonly = 0;
+	self->eager_work = 1;
 	self->safety = LSM_SAFETY_NORMAL;
 	self->use_log = 1;
 	self->tx_level = 0;
@@ -1081,6 +2493,59 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 	self->compress_level = PYLSM_DEFAULT_COMPRESS_LEVEL;
 	self->path = NULL;
 	self->binary = 1;
+	self->key_count = 0;
+	self->key_count_valid = 0;
+	self->csr_pool = NULL;
+	self->csr_pool_size = 4;
+	self->csr_pool_used = 0;
+	self->buf_pool_used = 0;
+	self->iter_prefetch = PYLSM_ITER_PREFETCH_DEFAULT;
+	self->bloom_bits_per_key = 0;
+	self->bloom = NULL;
+	self->bloom_nbits = 0;
+	self->bloom_hashes = 0;
+	self->stat_gets = 0;
+	self->stat_inserts = 0;
+	self->stat_deletes = 0;
+	self->stat_cursors = 0;
+	self->stat_lock_wait_ns = 0;
+	self->stat_pages_raw = 0;
+	self->stat_pages_compressed = 0;
+	self->stat_group_commits = 0;
+	self->stat_group_syncs = 0;
+	self->compress_adaptive = 0;
+	self->lz4_acceleration = 0;
+	self->adapt_in_bytes = 0;
+	self->adapt_out_bytes = 0;
+	self->adapt_pages = 0;
+	self->zstd_cctx = NULL;
+	self->zstd_dctx = NULL;
+	self->compress_dict = NULL;
+	self->compress_dict_len = 0;
+	self->zstd_mutex = NULL;
+	self->logger_buffered = 0;
+	self->log_ring = NULL;
+	self->log_head = 0;
+	self->log_tail = 0;
+	self->log_dropped = 0;
+#ifdef LSM_MUTEX_PTHREADS
+	self->worker_lsm = NULL;
+	self->worker_state = PY_LSM_WORKER_STOPPED;
+	self->worker_pending = 0;
+	self->worker_written = 0;
+	self->worker_checkpointed = 0;
+	pthread_rwlock_init(&self->rwlock, NULL);
+	pthread_mutex_init(&self->pool_mutex, NULL);
+	pthread_mutex_init(&self->group_mutex, NULL);
+	pthread_cond_init(&self->group_cond, NULL);
+	self->group_open = 0;
+	self->group_active = 0;
+	self->group_pending = 0;
+	self->group_departing = 0;
+	self->group_poisoned = 0;
+	self->group_rc = LSM_OK;
+	self->group_generation = 0;
+#endif
 	memset(&self->lsm_compress, 0, sizeof(lsm_compress));
 
 	static char* kwlist[] = {
@@ -1101,10 +2566,19 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 		"logger",
 		"compress",
 		"compress_level",
+		"cursor_pool_size",
+		"compress_dict",
+		"iter_prefetch",
+		"eager_work",
+		"logger_buffered",
+		"bloom_bits_per_key",
+		"compress_adaptive",
 		NULL
 	};
 
 	PyObject* compress = Py_None;
+	PyObject* compress_dict = Py_None;
+	PyObject* binary_obj = NULL;
 	int compressor_id = LSM_COMPRESSION_NONE;
 
 	PyObject* pyPath;
@@ -1112,7 +2586,7 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 	Py_ssize_t path_len;
 
 	if (!PyArg_ParseTupleAndKeywords(
-		args, kwds, "O|iiIIIIIppppppOOi", kwlist,
+		args, kwds, "O|iiIIIIIpppppOOOiiOippip", kwlist,
 		&pyPath,
 		&self->autoflush,
 		&self->page_size,
@@ -1126,12 +2600,37 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 		&self->use_log,
 		&self->multiple_processes,
 		&self->readonly,
-		&self->binary,
+		&binary_obj,
 		&self->logger,
 		&compress,
-		&self->compress_level
+		&self->compress_level,
+		&self->csr_pool_size,
+		&compress_dict,
+		&self->iter_prefetch,
+		&self->eager_work,
+		&self->logger_buffered,
+		&self->bloom_bits_per_key,
+		&self->compress_adaptive
 	)) return -1;
 
+	if (binary_obj != NULL) {
+		if (PyUnicode_Check(binary_obj)) {
+			if (PyUnicode_CompareWithASCIIString(binary_obj, "int") != 0) {
+				PyErr_Format(
+					PyExc_ValueError,
+					"binary must be a bool or \"int\". Not %R",
+					binary_obj
+				);
+				return -1;
+			}
+			self->binary = PY_LSM_KEY_INT;
+		} else {
+			int truthy = PyObject_IsTrue(binary_obj);
+			if (truthy < 0) return -1;
+			self->binary = truthy ? PY_LSM_KEY_BYTES : PY_LSM_KEY_STR;
+		}
+	}
+
 	if (!PyUnicode_Check(pyPath)) pyPath = PyObject_Str(pyPath);
 
 	path = PyUnicode_AsUTF8AndSize(pyPath, &path_len);
@@ -1160,6 +2659,40 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 		return -1;
 	}
 
+	if (self->csr_pool_size < 0 || self->csr_pool_size > 1024) {
+		PyErr_Format(
+			PyExc_ValueError,
+			"cursor_pool_size must be between 0 and 1024. Not %d",
+			self->csr_pool_size
+		);
+		return -1;
+	}
+
+	if (self->iter_prefetch < 1 || self->iter_prefetch > PYLSM_ITER_PREFETCH_MAX) {
+		PyErr_Format(
+			PyExc_ValueError,
+			"iter_prefetch must be between 1 and %d. Not %d",
+			PYLSM_ITER_PREFETCH_MAX, self->iter_prefetch
+		);
+		return -1;
+	}
+
+	if (
+		self->bloom_bits_per_key < 0 ||
+		self->bloom_bits_per_key > PYLSM_BLOOM_MAX_BITS_PER_KEY
+	) {
+		PyErr_Format(
+			PyExc_ValueError,
+			"bloom_bits_per_key must be between 0 and %d. Not %d",
+			PYLSM_BLOOM_MAX_BITS_PER_KEY, self->bloom_bits_per_key
+		);
+		return -1;
+	}
+
+	if (self->csr_pool_size > 0) {
+		self->csr_pool = PyMem_Calloc(self->csr_pool_size, sizeof(lsm_cursor*));
+	}
+
 	if (self->autocheckpoint <= 0) {
 		PyErr_SetString(
 			PyExc_ValueError,
@@ -1243,6 +2776,53 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 		return -1;
 	}
 
+	if (compress_dict != Py_None) {
+		if (compressor_id != PY_LSM_COMPRESSOR_ZSTD) {
+			PyErr_SetString(
+				PyExc_ValueError,
+				"compress_dict is only supported with compress=\"zstd\""
+			);
+			return -1;
+		}
+
+		if (!PyBytes_Check(compress_dict)) {
+			PyErr_Format(
+				PyExc_ValueError,
+				"bytes expected not %R",
+				PyObject_Type(compress_dict)
+			);
+			return -1;
+		}
+
+		self->compress_dict_len = PyBytes_GET_SIZE(compress_dict);
+		self->compress_dict = PyMem_Calloc(sizeof(char), self->compress_dict_len + 1);
+		memcpy(
+			self->compress_dict,
+			PyBytes_AS_STRING(compress_dict),
+			self->compress_dict_len
+		);
+	}
+
+	if (self->compress_adaptive) {
+		switch (compressor_id) {
+			case PY_LSM_COMPRESSOR_LZ4:
+				compressor_id = PY_LSM_COMPRESSOR_LZ4_ADAPTIVE;
+				self->lz4_acceleration =
+					(2 << (15 - self->compress_level)) + 1;
+				break;
+			case PY_LSM_COMPRESSOR_ZSTD:
+				compressor_id = PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE;
+				break;
+			default:
+				PyErr_SetString(
+					PyExc_ValueError,
+					"compress_adaptive=True requires "
+					"compress=\"lz4\" or \"zstd\""
+				);
+				return -1;
+		}
+	}
+
 	if (compressor_id > PY_LSM_COMPRESSOR_NONE) self->compressed = 1;
 
 	if (self->logger != NULL && !PyCallable_Check(self->logger)) {
@@ -1250,6 +2830,23 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 		return -1;
 	}
 
+	if (self->logger_buffered && self->logger == NULL) {
+		PyErr_SetString(
+			PyExc_ValueError, "logger_buffered=True requires a logger"
+		);
+		return -1;
+	}
+
+	if (self->logger_buffered) {
+		self->log_ring = PyMem_Calloc(
+			PYLSM_LOG_RING_SIZE, sizeof(LSMLogEntry)
+		);
+		if (self->log_ring == NULL) {
+			PyErr_SetString(PyExc_MemoryError, "Can not allocate memory");
+			return -1;
+		}
+	}
+
 	if (self->logger != NULL) Py_INCREF(self->logger);
 	if (pylsm_error(lsm_new(NULL, &self->lsm))) return -1;
 
@@ -1258,7 +2855,13 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 	if (pylsm_error(self->lsm_env->xMutexNew(self->lsm_env, &self->lsm_mutex))) return -1;
 
 	if (self->logger != NULL) {
-		lsm_config_log(self->lsm, (void (*)(void *, int, const char *)) pylsm_logger, self);
+		lsm_config_log(
+			self->lsm,
+			(void (*)(void *, int, const char *)) (
+				self->logger_buffered ? pylsm_logger_buffered : pylsm_logger
+			),
+			self
+		);
 	} else {
 		lsm_config_log(self->lsm, NULL, NULL);
 	}
@@ -1285,6 +2888,35 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 				self->lsm_compress.xUncompress = (int (*)(void *, char *, int *, const char *, int)) pylsm_zstd_xUncompress;
 				self->lsm_compress.xBound = (int (*)(void *, int)) pylsm_zstd_xBound;
 				self->lsm_compress.xFree = NULL;
+
+				self->zstd_cctx = ZSTD_createCCtx();
+				self->zstd_dctx = ZSTD_createDCtx();
+
+				if (self->zstd_cctx == NULL || self->zstd_dctx == NULL) {
+					PyErr_SetString(PyExc_MemoryError, "Can not allocate zstd context");
+					return -1;
+				}
+
+				if (pylsm_error(self->lsm_env->xMutexNew(self->lsm_env, &self->zstd_mutex))) return -1;
+				break;
+			case PY_LSM_COMPRESSOR_LZ4_ADAPTIVE:
+			case PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE:
+				self->lsm_compress.xCompress = (int (*)(void *, char *, int *, const char *, int)) pylsm_adaptive_xCompress;
+				self->lsm_compress.xUncompress = (int (*)(void *, char *, int *, const char *, int)) pylsm_adaptive_xUncompress;
+				self->lsm_compress.xBound = (int (*)(void *, int)) pylsm_adaptive_xBound;
+				self->lsm_compress.xFree = NULL;
+
+				if (compressor_id == PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE) {
+					self->zstd_cctx = ZSTD_createCCtx();
+					self->zstd_dctx = ZSTD_createDCtx();
+
+					if (self->zstd_cctx == NULL || self->zstd_dctx == NULL) {
+						PyErr_SetString(PyExc_MemoryError, "Can not allocate zstd context");
+						return -1;
+					}
+
+					if (pylsm_error(self->lsm_env->xMutexNew(self->lsm_env, &self->zstd_mutex))) return -1;
+				}
 				break;
 		}
 
@@ -1313,12 +2945,12 @@ static int LSM_init(LSM *self, PyObject *args, PyObject *kwds) {
 
 
 static PyObject* LSM_open(LSM *self) {
-	if (self->state == PY_LSM_OPENED) {
+	if (PYLSM_FIELD_GET(self, state) == PY_LSM_OPENED) {
 		PyErr_SetString(PyExc_RuntimeError, "Database already opened");
 		return NULL;
 	}
 
-	if (self->state == PY_LSM_CLOSED) {
+	if (PYLSM_FIELD_GET(self, state) == PY_LSM_CLOSED) {
 		PyErr_SetString(PyExc_RuntimeError, "Database closed");
 		return NULL;
 	}
@@ -1328,7 +2960,10 @@ static PyObject* LSM_open(LSM *self) {
 
 	if (pylsm_error(result)) return NULL;
 
-	if (self->readonly == 0) {
+	// Catch-up flush/merge on open can cost tens of seconds on a big
+	// store; eager_work=False defers it to autowork or the background
+	// worker so cold start stays in milliseconds.
+	if (self->readonly == 0 && self->eager_work) {
 		Py_BEGIN_ALLOW_THREADS
 		result = lsm_flush(self->lsm);
 		Py_END_ALLOW_THREADS
@@ -1342,16 +2977,70 @@ static PyObject* LSM_open(LSM *self) {
 		if (pylsm_error(result)) return NULL;
 	}
 
-	self->state = PY_LSM_OPENED;
+	if (self->bloom_bits_per_key > 0) {
+		Py_BEGIN_ALLOW_THREADS
+		result = pylsm_bloom_build(self);
+		Py_END_ALLOW_THREADS
+
+		if (pylsm_error(result)) return NULL;
+	}
+
+	PYLSM_FIELD_SET(self, state, PY_LSM_OPENED);
 	Py_RETURN_TRUE;
 }
 
+// Consumer side of the log ring: delivers buffered engine messages to
+// the Python logger and returns how many were handed over. Stops at the
+// first slot a producer has claimed but not finished writing — it is
+// picked up by the next drain.
+static PyObject* LSM_drain_logs(LSM *self) {
+	Py_ssize_t delivered = 0;
+	unsigned long long tail;
+	LSMLogEntry *entry;
+	PyObject *result;
+
+	if (self->log_ring == NULL) {
+		PyErr_SetString(
+			PyExc_RuntimeError,
+			"Database was not opened with logger_buffered=True"
+		);
+		return NULL;
+	}
+
+	tail = __atomic_load_n(&self->log_tail, __ATOMIC_RELAXED);
+
+	while (tail < __atomic_load_n(&self->log_head, __ATOMIC_ACQUIRE)) {
+		entry = &self->log_ring[tail % PYLSM_LOG_RING_SIZE];
+		if (!__atomic_load_n(&entry->ready, __ATOMIC_ACQUIRE)) break;
+
+		result = PyObject_CallFunction(
+			self->logger, "sI", entry->message, entry->rc
+		);
+		if (result == NULL) PyErr_Print();
+		Py_XDECREF(result);
+
+		__atomic_store_n(&entry->ready, 0, __ATOMIC_RELAXED);
+		tail++;
+		__atomic_store_n(&self->log_tail, tail, __ATOMIC_RELEASE);
+		delivered++;
+	}
+
+	return PyLong_FromSsize_t(delivered);
+}
+
+
 static PyObject* LSM_close(LSM *self) {
-	if (self->state == PY_LSM_CLOSED) {
+	if (PYLSM_FIELD_GET(self, state) == PY_LSM_CLOSED) {
 		PyErr_SetString(PyExc_RuntimeError, "Database already closed");
 		return NULL;
 	}
 
+	// Flush any buffered engine messages while the logger may still be
+	// useful; errors here must not prevent the close itself.
+	if (self->log_ring != NULL && PYLSM_FIELD_GET(self, state) == PY_LSM_OPENED) {
+		Py_XDECREF(LSM_drain_logs(self));
+	}
+
 	if (pylsm_error(_LSM_close(self))) return NULL;
 	Py_RETURN_TRUE;
 }
@@ -1371,8 +3060,14 @@ static PyObject* LSM_info(LSM *self) {
 		tree_size_current = 0,
 		tree_size_result = 0;
 
+	char *db_structure = NULL;
+	char *log_structure = NULL;
+	char *freelist = NULL;
+	unsigned int compression_id = 0;
+	int compression_id_result = 0;
+
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_ReadLock(self);
 
 	nread_result = lsm_info(
 		self->lsm, LSM_INFO_NREAD, &nread
@@ -1390,7 +3085,19 @@ static PyObject* LSM_info(LSM *self) {
 		self->lsm, LSM_INFO_TREE_SIZE, &tree_size_old, &tree_size_current
 	);
 
-	LSM_MutexLeave(self);
+	// Structure dumps are advisory: ignore per-key failures and leave
+	// the field out rather than turning info() into an error source.
+	if (!self->readonly) {
+		if (lsm_info(self->lsm, LSM_INFO_DB_STRUCTURE, &db_structure)) db_structure = NULL;
+		if (lsm_info(self->lsm, LSM_INFO_LOG_STRUCTURE, &log_structure)) log_structure = NULL;
+		if (lsm_info(self->lsm, LSM_INFO_FREELIST, &freelist)) freelist = NULL;
+	}
+
+	compression_id_result = lsm_info(
+		self->lsm, LSM_INFO_COMPRESSION_ID, &compression_id
+	);
+
+	LSM_ReadUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(nread_result)) return NULL;
@@ -1400,18 +3107,85 @@ static PyObject* LSM_info(LSM *self) {
 	if (pylsm_error(checkpoint_size_result)) return NULL;
 	if (pylsm_error(tree_size_result)) return NULL;
 
-	return Py_BuildValue(
+	PyObject* result = Py_BuildValue(
 		"{sisisis{sisi}}",
 		"nwrite", nwrite,
 		"nread", nread,
 		"checkpoint_size_result", checkpoint_size,
 		"tree_size", "old", tree_size_old, "current", tree_size_current
 	);
+	if (result == NULL) goto done;
+
+	if (db_structure != NULL) {
+		PyObject* value = PyUnicode_FromString(db_structure);
+		if (value == NULL || PyDict_SetItemString(result, "db_structure", value)) {
+			Py_XDECREF(value);
+			Py_CLEAR(result);
+			goto done;
+		}
+		Py_DECREF(value);
+	}
+
+	if (log_structure != NULL) {
+		PyObject* value = PyUnicode_FromString(log_structure);
+		if (value == NULL || PyDict_SetItemString(result, "log_structure", value)) {
+			Py_XDECREF(value);
+			Py_CLEAR(result);
+			goto done;
+		}
+		Py_DECREF(value);
+	}
+
+	if (freelist != NULL) {
+		PyObject* value = PyUnicode_FromString(freelist);
+		if (value == NULL || PyDict_SetItemString(result, "freelist", value)) {
+			Py_XDECREF(value);
+			Py_CLEAR(result);
+			goto done;
+		}
+		Py_DECREF(value);
+	}
+
+	if (compression_id_result == LSM_OK) {
+		PyObject* value = PyLong_FromUnsignedLong(compression_id);
+		if (value == NULL || PyDict_SetItemString(result, "compression_id", value)) {
+			Py_XDECREF(value);
+			Py_CLEAR(result);
+			goto done;
+		}
+		Py_DECREF(value);
+	}
+
+done:
+	if (db_structure != NULL) lsm_free(self->lsm_env, db_structure);
+	if (log_structure != NULL) lsm_free(self->lsm_env, log_structure);
+	if (freelist != NULL) lsm_free(self->lsm_env, freelist);
+
+	return result;
+}
+
+
+// Wrapper-side operation counters. These never touch the engine, so
+// reading them is safe from any thread at any time.
+static PyObject* LSM_stats(LSM *self) {
+	return Py_BuildValue(
+		"{sLsLsLsLsLsLsLsLsLsL}",
+		"gets", __atomic_load_n(&self->stat_gets, __ATOMIC_RELAXED),
+		"inserts", __atomic_load_n(&self->stat_inserts, __ATOMIC_RELAXED),
+		"deletes", __atomic_load_n(&self->stat_deletes, __ATOMIC_RELAXED),
+		"cursors_opened", __atomic_load_n(&self->stat_cursors, __ATOMIC_RELAXED),
+		"lock_wait_ns", __atomic_load_n(&self->stat_lock_wait_ns, __ATOMIC_RELAXED),
+		"log_dropped", __atomic_load_n(&self->log_dropped, __ATOMIC_RELAXED),
+		"pages_raw", __atomic_load_n(&self->stat_pages_raw, __ATOMIC_RELAXED),
+		"pages_compressed", __atomic_load_n(&self->stat_pages_compressed, __ATOMIC_RELAXED),
+		"group_commits", __atomic_load_n(&self->stat_group_commits, __ATOMIC_RELAXED),
+		"group_syncs", __atomic_load_n(&self->stat_group_syncs, __ATOMIC_RELAXED)
+	);
 }
 
 
 static PyObject* LSM_ctx_enter(LSM *self) {
-	if (self->state == PY_LSM_OPENED) return (PyObject*) self;
+	if (PYLSM_FIELD_GET(self, state) == PY_LSM_OPENED) return (PyObject*) self;
 
 	Py_INCREF(self);
 
@@ -1460,7 +3234,7 @@ static PyObject* LSM_work(LSM *self, PyObject *args, PyObject *kwds) {
 	int written = 0;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
 
 	do {
 		result = lsm_work(self->lsm, nmerge, nkb, &written);
@@ -1468,7 +3242,7 @@ static PyObject* LSM_work(LSM *self, PyObject *args, PyObject *kwds) {
 		if (nmerge < self->automerge) nmerge++;
 	} while (complete && written > 0);
 
-	LSM_MutexLeave(self);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
@@ -1476,47 +3250,185 @@ static PyObject* LSM_work(LSM *self, PyObject *args, PyObject *kwds) {
 }
 
 
-static PyObject* LSM_flush(LSM *self) {
-	if (pylsm_ensure_writable(self)) return NULL;
-
+#ifdef LSM_MUTEX_PTHREADS
+static int pylsm_worker_open(LSM* self) {
 	int rc;
+	int autowork = 0;
 
-	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-	rc = lsm_flush(self->lsm);
-	LSM_MutexLeave(self);
-	Py_END_ALLOW_THREADS
+	if ((rc = lsm_new(NULL, &self->worker_lsm))) return rc;
 
-	if (pylsm_error(rc)) return NULL;
-	Py_RETURN_TRUE;
+	if (self->compressed) {
+		if ((rc = lsm_config(
+			self->worker_lsm, LSM_CONFIG_SET_COMPRESSION, &self->lsm_compress
+		))) return rc;
+	}
+
+	if ((rc = lsm_config(self->worker_lsm, LSM_CONFIG_AUTOWORK, &autowork))) return rc;
+	if ((rc = lsm_config(self->worker_lsm, LSM_CONFIG_MULTIPLE_PROCESSES, &self->multiple_processes))) return rc;
+	if ((rc = lsm_config(self->worker_lsm, LSM_CONFIG_BLOCK_SIZE, &self->block_size))) return rc;
+	if ((rc = lsm_config(self->worker_lsm, LSM_CONFIG_PAGE_SIZE, &self->page_size))) return rc;
+
+	return lsm_open(self->worker_lsm, self->path);
 }
+#endif
 
-static PyObject* LSM_checkpoint(LSM *self) {
+
+static PyObject* LSM_start_worker(LSM *self, PyObject *args, PyObject *kwds) {
 	if (pylsm_ensure_writable(self)) return NULL;
 
-	int result;
-	int bytes_written = 0;
+#ifndef LSM_MUTEX_PTHREADS
+	PyErr_SetString(
+		PyExc_NotImplementedError,
+		"Background worker requires a pthreads build"
+	);
+	return NULL;
+#else
+	static char *kwlist[] = {"nmerge", "nkb", NULL};
+
+	int nmerge = self->automerge;
+	int nkb = self->autocheckpoint;
+	int rc;
+
+	if (!PyArg_ParseTupleAndKeywords(
+		args, kwds, "|II", kwlist, &nmerge, &nkb
+	)) return NULL;
+
+	if (self->worker_lsm != NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "Worker already started");
+		return NULL;
+	}
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-	result = lsm_checkpoint(self->lsm, &bytes_written);
-	LSM_MutexLeave(self);
+	rc = pylsm_worker_open(self);
 	Py_END_ALLOW_THREADS
 
-	if (pylsm_error(result)) return NULL;
-	return Py_BuildValue("i", bytes_written);
-}
-
-static PyObject* LSM_cursor(LSM *self, PyObject *args, PyObject *kwds) {
-	if (pylsm_ensure_opened(self)) return NULL;
+	if (rc != LSM_OK) {
+		if (self->worker_lsm != NULL) lsm_close(self->worker_lsm);
+		self->worker_lsm = NULL;
+		pylsm_error(rc);
+		return NULL;
+	}
 
-	int seek_mode = LSM_SEEK_GE;
-	static char *kwlist[] = {"seek_mode", NULL};
+	self->worker_nmerge = nmerge;
+	self->worker_nkb = nkb;
+	self->worker_pending = 1;
+	self->worker_written = 0;
+	self->worker_checkpointed = 0;
+	self->worker_state = PY_LSM_WORKER_RUNNING;
 
-	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|i", kwlist, &seek_mode)) return NULL;
-	if (pylsm_seek_mode_check(seek_mode)) return NULL;
+	pthread_mutex_init(&self->worker_mutex, NULL);
+	pthread_cond_init(&self->worker_cond, NULL);
 
-	LSMCursor* cursor = (LSMCursor*) LSMCursor_new(&LSMCursorType, self, seek_mode);
+	if (pthread_create(
+		&self->worker_thread, NULL, pylsm_worker_main, self
+	)) {
+		self->worker_state = PY_LSM_WORKER_STOPPED;
+		pthread_cond_destroy(&self->worker_cond);
+		pthread_mutex_destroy(&self->worker_mutex);
+		lsm_close(self->worker_lsm);
+		self->worker_lsm = NULL;
+		PyErr_SetString(PyExc_RuntimeError, "Can not start worker thread");
+		return NULL;
+	}
+
+	Py_RETURN_TRUE;
+#endif
+}
+
+
+static PyObject* LSM_stop_worker(LSM *self) {
+#ifndef LSM_MUTEX_PTHREADS
+	PyErr_SetString(
+		PyExc_NotImplementedError,
+		"Background worker requires a pthreads build"
+	);
+	return NULL;
+#else
+	if (self->worker_lsm == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "Worker is not running");
+		return NULL;
+	}
+
+	if (pylsm_error(pylsm_worker_shutdown(self))) return NULL;
+	Py_RETURN_TRUE;
+#endif
+}
+
+
+static PyObject* LSM_worker_stats(LSM *self) {
+#ifndef LSM_MUTEX_PTHREADS
+	PyErr_SetString(
+		PyExc_NotImplementedError,
+		"Background worker requires a pthreads build"
+	);
+	return NULL;
+#else
+	int running = 0;
+	int pending = 0;
+	long long written = 0;
+	long long checkpointed = 0;
+
+	if (self->worker_lsm != NULL) {
+		pthread_mutex_lock(&self->worker_mutex);
+		running = (self->worker_state == PY_LSM_WORKER_RUNNING);
+		pending = self->worker_pending;
+		written = self->worker_written;
+		checkpointed = self->worker_checkpointed;
+		pthread_mutex_unlock(&self->worker_mutex);
+	}
+
+	return Py_BuildValue(
+		"{sOsisLsL}",
+		"running", running ? Py_True : Py_False,
+		"pending", pending,
+		"written", written,
+		"checkpointed", checkpointed
+	);
+#endif
+}
+
+
+static PyObject* LSM_flush(LSM *self) {
+	if (pylsm_ensure_writable(self)) return NULL;
+
+	int rc;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_WriteLock(self);
+	rc = lsm_flush(self->lsm);
+	LSM_WriteUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+	Py_RETURN_TRUE;
+}
+
+static PyObject* LSM_checkpoint(LSM *self) {
+	if (pylsm_ensure_writable(self)) return NULL;
+
+	int result;
+	int bytes_written = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_WriteLock(self);
+	result = lsm_checkpoint(self->lsm, &bytes_written);
+	LSM_WriteUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(result)) return NULL;
+	return Py_BuildValue("i", bytes_written);
+}
+
+static PyObject* LSM_cursor(LSM *self, PyObject *args, PyObject *kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	int seek_mode = LSM_SEEK_GE;
+	static char *kwlist[] = {"seek_mode", NULL};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|i", kwlist, &seek_mode)) return NULL;
+	if (pylsm_seek_mode_check(seek_mode)) return NULL;
+
+	LSMCursor* cursor = (LSMCursor*) LSMCursor_new(&LSMCursorType, self, seek_mode);
 	if (cursor == NULL) return NULL;
 
 	return (PyObject*) cursor;
@@ -1533,8 +3445,14 @@ static PyObject* LSM_insert(LSM *self, PyObject *args, PyObject *kwds) {
 
 	const char* pVal = NULL;
 	Py_ssize_t nVal = 0;
-
-	if (self->binary) {
+	char packed[PYLSM_INT_KEY_SIZE];
+
+	if (self->binary == PY_LSM_KEY_INT) {
+		PyObject *key, *value;
+		if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO", kwlist, &key, &value)) return NULL;
+		if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) return NULL;
+		if (str_or_bytes_check(PY_LSM_KEY_BYTES, value, &pVal, &nVal)) return NULL;
+	} else if (self->binary) {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "y#y#", kwlist, &pKey, &nKey, &pVal, &nVal)) return NULL;
 	} else {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "s#s#", kwlist, &pKey, &nKey, &pVal, &nVal)) return NULL;
@@ -1552,12 +3470,13 @@ static PyObject* LSM_insert(LSM *self, PyObject *args, PyObject *kwds) {
 	int result;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-	result = lsm_insert(self->lsm, pKey, (int) nKey, pVal, (int) nVal);
-	LSM_MutexLeave(self);
+	LSM_WriteLock(self);
+	result = pylsm_insert_tracked(self, pKey, (int) nKey, pVal, (int) nVal);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
+	pylsm_worker_notify(self);
 	Py_RETURN_NONE;
 }
 
@@ -1569,8 +3488,13 @@ static PyObject* LSM_delete(LSM *self, PyObject *args, PyObject *kwds) {
 
 	const char* pKey = NULL;
 	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
 
-	if (self->binary) {
+	if (self->binary == PY_LSM_KEY_INT) {
+		PyObject *key;
+		if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &key)) return NULL;
+		if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) return NULL;
+	} else if (self->binary) {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "y#", kwlist, &pKey, &nKey)) return NULL;
 	} else {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "s#", kwlist, &pKey, &nKey)) return NULL;
@@ -1583,12 +3507,13 @@ static PyObject* LSM_delete(LSM *self, PyObject *args, PyObject *kwds) {
 
 	int result;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-	result = lsm_delete(self->lsm, pKey, (int) nKey);
-	LSM_MutexLeave(self);
+	LSM_WriteLock(self);
+	result = pylsm_delete_tracked(self, pKey, (int) nKey);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
+	pylsm_worker_notify(self);
 	Py_RETURN_NONE;
 }
 
@@ -1603,8 +3528,15 @@ static PyObject* LSM_delete_range(LSM *self, PyObject *args, PyObject *kwds) {
 
 	const char* pEnd = NULL;
 	Py_ssize_t nEnd = 0;
-
-	if (self->binary) {
+	char packed_start[PYLSM_INT_KEY_SIZE];
+	char packed_end[PYLSM_INT_KEY_SIZE];
+
+	if (self->binary == PY_LSM_KEY_INT) {
+		PyObject *start, *end;
+		if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO", kwlist, &start, &end)) return NULL;
+		if (pylsm_key_check(self->binary, start, &pStart, &nStart, packed_start)) return NULL;
+		if (pylsm_key_check(self->binary, end, &pEnd, &nEnd, packed_end)) return NULL;
+	} else if (self->binary) {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "y#y#", kwlist, &pStart, &nStart, &pEnd, &nEnd)) return NULL;
 	} else {
 		if (!PyArg_ParseTupleAndKeywords(args, kwds, "s#s#", kwlist, &pStart, &nStart, &pEnd, &nEnd)) return NULL;
@@ -1621,31 +3553,38 @@ static PyObject* LSM_delete_range(LSM *self, PyObject *args, PyObject *kwds) {
 
 	int result;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
+	pylsm_csr_pool_drain(self);
 	result = lsm_delete_range(self->lsm, pStart, (int) nStart, pEnd, (int) nEnd);
-	LSM_MutexLeave(self);
+	self->key_count_valid = 0;
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
+	PYLSM_STAT_ADD(self, stat_deletes, 1);
+	pylsm_worker_notify(self);
 	Py_RETURN_NONE;
 }
 
 
 static PyObject* LSM_begin(LSM *self) {
 	if (pylsm_ensure_writable(self)) return NULL;
-	if (self->tx_level < 0) self->tx_level = 0;
 
-	int level = self->tx_level + 1;
 	int result;
 
+	// Level bookkeeping happens under the write lock so that two
+	// threads beginning transactions concurrently cannot both claim
+	// the same nesting level.
 	Py_BEGIN_ALLOW_THREADS
-	result = lsm_begin(self->lsm, level);
+	LSM_WriteLock(self);
+	if (self->tx_level < 0) self->tx_level = 0;
+	result = lsm_begin(self->lsm, self->tx_level + 1);
+	if (result == LSM_OK) self->tx_level++;
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
 
-	self->tx_level = level;
-
 	Py_RETURN_TRUE;
 }
 
@@ -1656,9 +3595,9 @@ static PyObject* LSM_commit_inner(LSM *self, int tx_level) {
 
 	int result;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
 	result = lsm_commit(self->lsm, tx_level);
-	LSM_MutexLeave(self);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
@@ -1672,9 +3611,11 @@ static PyObject* LSM_rollback_inner(LSM *self, int tx_level) {
 
 	int result;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
+	pylsm_csr_pool_drain(self);
 	result = lsm_rollback(self->lsm, tx_level);
-	LSM_MutexLeave(self);
+	self->key_count_valid = 0;
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
@@ -1683,6 +3624,126 @@ static PyObject* LSM_rollback_inner(LSM *self, int tx_level) {
 
 
 
+#ifdef LSM_MUTEX_PTHREADS
+// Cross-thread group commit. Transactions opened with group=True all
+// write into one shared engine transaction: joiners piggyback on the
+// open one, committers leave cheaply, and the last one out performs
+// the single lsm_commit — under SAFETY_FULL one log sync for the
+// whole batch instead of one per caller — then wakes everybody. A
+// rollback poisons the batch: whoever closes it rolls the whole thing
+// back and the coalesced committers fail with PYLSM_GROUP_ABORTED
+// rather than report durability they never got. Both helpers expect
+// the GIL released; group_mutex is taken before the write lock and
+// never the other way around.
+static int pylsm_group_join(LSM* self) {
+	int rc = LSM_OK;
+
+	pthread_mutex_lock(&self->group_mutex);
+
+	if (!self->group_open) {
+		LSM_WriteLock(self);
+		if (self->tx_level != 0) {
+			rc = LSM_MISUSE;
+		} else if ((rc = lsm_begin(self->lsm, 1)) == LSM_OK) {
+			self->tx_level = 1;
+			self->group_open = 1;
+			self->group_poisoned = 0;
+		}
+		LSM_WriteUnlock(self);
+	}
+
+	if (rc == LSM_OK) self->group_active++;
+
+	pthread_mutex_unlock(&self->group_mutex);
+	return rc;
+}
+
+
+static int pylsm_group_leave(LSM* self, int poison) {
+	int rc = LSM_OK;
+
+	pthread_mutex_lock(&self->group_mutex);
+
+	if (poison) self->group_poisoned = 1;
+	self->group_active--;
+
+	if (self->group_active > 0) {
+		// Somebody is still writing; they will close the batch. A
+		// poisoner does not wait for the outcome — its changes are
+		// discarded either way.
+		if (!poison) {
+			unsigned long long gen = self->group_generation;
+
+			self->group_pending++;
+			while (self->group_generation == gen) {
+				pthread_cond_wait(&self->group_cond, &self->group_mutex);
+			}
+			rc = self->group_rc;
+			self->group_departing--;
+			if (self->group_departing == 0) {
+				pthread_cond_broadcast(&self->group_cond);
+			}
+		}
+	} else {
+		// Leader. Its own batch's waiters sit in group_pending; only
+		// the finished generation's waiters — woken already, merely
+		// yet to read group_rc — are in group_departing, so draining
+		// them before overwriting group_rc cannot wait on anybody who
+		// is waiting on this leader.
+		while (self->group_departing > 0) {
+			pthread_cond_wait(&self->group_cond, &self->group_mutex);
+		}
+
+		LSM_WriteLock(self);
+		if (self->group_poisoned) {
+			pylsm_csr_pool_drain(self);
+			rc = lsm_rollback(self->lsm, 0);
+			self->key_count_valid = 0;
+			if (rc == LSM_OK) rc = PYLSM_GROUP_ABORTED;
+		} else {
+			rc = lsm_commit(self->lsm, 0);
+			PYLSM_STAT_ADD(self, stat_group_syncs, 1);
+		}
+		self->tx_level = 0;
+		LSM_WriteUnlock(self);
+
+		self->group_rc = rc;
+		self->group_open = 0;
+		self->group_departing = self->group_pending;
+		self->group_pending = 0;
+		self->group_generation++;
+		pthread_cond_broadcast(&self->group_cond);
+
+		// The poisoner's own rollback succeeding is not an error.
+		if (poison && rc == PYLSM_GROUP_ABORTED) rc = LSM_OK;
+	}
+
+	if (!poison) PYLSM_STAT_ADD(self, stat_group_commits, 1);
+
+	pthread_mutex_unlock(&self->group_mutex);
+	return rc;
+}
+
+
+// GIL-holding wrapper around pylsm_group_leave that raises on failure.
+static int pylsm_group_leave_checked(LSM* db, int poison) {
+	int rc;
+
+	Py_BEGIN_ALLOW_THREADS
+	rc = pylsm_group_leave(db, poison);
+	Py_END_ALLOW_THREADS
+
+	if (rc == PYLSM_GROUP_ABORTED) {
+		PyErr_SetString(
+			PyExc_RuntimeError, "group commit was rolled back"
+		);
+		return -1;
+	}
+	return pylsm_error(rc);
+}
+#endif
+
+
 static PyObject* LSM_commit(LSM *self) {
 	if (self->tx_level < 0) self->tx_level = 0;
 	return LSM_commit_inner(self, self->tx_level);
@@ -1701,6 +3762,7 @@ static PyObject* LSM_getitem(LSM *self, PyObject *arg) {
 	PyObject* key = arg;
 	const char* pKey = NULL;
 	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
 	Py_ssize_t tuple_size;
 	int seek_mode = LSM_SEEK_EQ;
 
@@ -1740,7 +3802,7 @@ static PyObject* LSM_getitem(LSM *self, PyObject *arg) {
 
 	if (pylsm_seek_mode_check(seek_mode)) return NULL;
 
-	if (str_or_bytes_check(self->binary, key, &pKey, &nKey)) return NULL;
+	if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) return NULL;
 	if (nKey >= INT_MAX) {
 		PyErr_SetString(PyExc_OverflowError, "length of key is too large");
 		return NULL;
@@ -1749,20 +3811,21 @@ static PyObject* LSM_getitem(LSM *self, PyObject *arg) {
 	int result;
 	char *pValue = NULL;
 	int nValue = 0;
+	size_t cap = 0;
+	PyObject* py_value = NULL;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-
+	LSM_ReadLock(self);
 	result = pylsm_getitem(
-		self->lsm,
+		self,
 		pKey,
 		(int) nKey,
 		&pValue,
 		&nValue,
+		&cap,
 		seek_mode
 	);
-
-	LSM_MutexLeave(self);
+	LSM_ReadUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (result == -1) {
@@ -1771,21 +3834,179 @@ static PyObject* LSM_getitem(LSM *self, PyObject *arg) {
 			"Key %R was not found",
 			key
 		);
-		if (pValue != NULL) free(pValue);
 		return NULL;
 	}
+
+	if (pylsm_error(result)) return NULL;
+
 	if (pValue == NULL) Py_RETURN_TRUE;
 
-	if (pylsm_error(result)) {
-		if (pValue != NULL) free(pValue);
+	py_value = Py_BuildValue(
+		self->binary ? "y#" : "s#", pValue, (Py_ssize_t) nValue
+	);
+	pylsm_buf_release(self, pValue, cap);
+	return py_value;
+}
+
+
+static PyObject* LSM_getmany(LSM *self, PyObject *args, PyObject *kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"keys", "default", NULL};
+
+	PyObject *keys = NULL;
+	PyObject *def = Py_None;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O", kwlist, &keys, &def)) return NULL;
+
+	// Sorted probing keeps adjacent lookups on the same pages
+	PyObject *sorted_keys = PySequence_List(keys);
+	if (sorted_keys == NULL) return NULL;
+	if (PyList_Sort(sorted_keys)) {
+		Py_DECREF(sorted_keys);
 		return NULL;
 	}
 
-	PyObject* py_value = Py_BuildValue(self->binary ? "y#" : "s#", pValue, nValue);
+	Py_ssize_t count = PyList_GET_SIZE(sorted_keys);
 
-	if (pValue != NULL) free(pValue);
+	const char** key_ptrs = PyMem_Calloc(count, sizeof(char*));
+	Py_ssize_t* key_lens = PyMem_Calloc(count, sizeof(Py_ssize_t));
+	char** val_ptrs = PyMem_Calloc(count, sizeof(char*));
+	int* val_lens = PyMem_Calloc(count, sizeof(int));
+	size_t* val_caps = PyMem_Calloc(count, sizeof(size_t));
+	char* packed = PyMem_Calloc(count, PYLSM_INT_KEY_SIZE);
 
-	return py_value;
+	int rc = 0;
+	Py_ssize_t i;
+
+	for (i = 0; i < count; i++) {
+		if (pylsm_key_check(
+			self->binary, PyList_GET_ITEM(sorted_keys, i),
+			&key_ptrs[i], &key_lens[i], packed + i * PYLSM_INT_KEY_SIZE
+		)) { rc = -1; break; }
+
+		if (key_lens[i] >= INT_MAX) {
+			PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+			rc = -1;
+			break;
+		}
+	}
+
+	if (rc == 0) {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_ReadLock(self);
+		rc = pylsm_getmany(self, key_ptrs, key_lens, count, val_ptrs, val_lens, val_caps);
+		LSM_ReadUnlock(self);
+		Py_END_ALLOW_THREADS
+
+		if (rc) pylsm_error(rc);
+	}
+
+	PyObject *result = NULL;
+
+	if (rc == 0) result = PyDict_New();
+
+	for (i = 0; result != NULL && i < count; i++) {
+		PyObject *value;
+
+		if (val_lens[i] < 0) {
+			value = def;
+			Py_INCREF(def);
+		} else {
+			value = Py_BuildValue(
+				self->binary ? "y#" : "s#",
+				val_ptrs[i], (Py_ssize_t) val_lens[i]
+			);
+		}
+
+		if (value == NULL || PyDict_SetItem(
+			result, PyList_GET_ITEM(sorted_keys, i), value
+		)) {
+			Py_XDECREF(value);
+			Py_CLEAR(result);
+			break;
+		}
+
+		Py_DECREF(value);
+	}
+
+	for (i = 0; i < count; i++) {
+		if (val_ptrs[i] != NULL) pylsm_buf_release(self, val_ptrs[i], val_caps[i]);
+	}
+
+	PyMem_Free(key_ptrs);
+	PyMem_Free(key_lens);
+	PyMem_Free(val_ptrs);
+	PyMem_Free(val_lens);
+	PyMem_Free(val_caps);
+	PyMem_Free(packed);
+
+	Py_DECREF(sorted_keys);
+	return result;
+}
+
+
+static PyObject* LSM_getview(LSM *self, PyObject *args, PyObject *kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"key", NULL};
+
+	PyObject* key = NULL;
+	const char* pKey = NULL;
+	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &key)) return NULL;
+	if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) return NULL;
+
+	if (nKey >= INT_MAX) {
+		PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+		return NULL;
+	}
+
+	LSMValueView *view = (LSMValueView *) LSMValueViewType.tp_alloc(&LSMValueViewType, 0);
+	if (view == NULL) return NULL;
+
+	view->db = self;
+	Py_INCREF(self);
+
+	int rc;
+	const char *pValue = NULL;
+	int nValue = 0;
+
+	PYLSM_STAT_ADD(self, stat_gets, 1);
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	if (!(rc = pylsm_csr_open_shared(self, &view->cursor))) {
+		if (!(rc = lsm_csr_seek(view->cursor, pKey, (int) nKey, LSM_SEEK_EQ))) {
+			if (!lsm_csr_valid(view->cursor)) {
+				rc = -1;
+			} else {
+				rc = lsm_csr_value(view->cursor, (const void **) &pValue, &nValue);
+			}
+		}
+	}
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (rc == -1) {
+		PyErr_Format(PyExc_KeyError, "Key %R was not found", key);
+		Py_DECREF(view);
+		return NULL;
+	}
+
+	if (pylsm_error(rc)) {
+		Py_DECREF(view);
+		return NULL;
+	}
+
+	view->pValue = pValue;
+	view->nValue = nValue;
+
+	PyObject* result = PyMemoryView_FromObject((PyObject*) view);
+	Py_DECREF(view);
+	return result;
 }
 
 
@@ -1823,9 +4044,11 @@ static int LSM_set_del_item(LSM* self, PyObject* key, PyObject* value) {
 		char *pStart = NULL;
 		Py_ssize_t nStart = 0;
 		Py_ssize_t nStop = 0;
+		char packed_start[PYLSM_INT_KEY_SIZE];
+		char packed_stop[PYLSM_INT_KEY_SIZE];
 
-		if (str_or_bytes_check(self->binary, slice->start, (const char **) &pStart, &nStart)) return -1;
-		if (str_or_bytes_check(self->binary, slice->stop, (const char **) &pStop, &nStop)) return -1;
+		if (pylsm_key_check(self->binary, slice->start, (const char **) &pStart, &nStart, packed_start)) return -1;
+		if (pylsm_key_check(self->binary, slice->stop, (const char **) &pStop, &nStop, packed_stop)) return -1;
 
 		if (nStart >= INT_MAX) {
 			PyErr_SetString(PyExc_OverflowError, "length of start is too large");
@@ -1842,13 +4065,15 @@ static int LSM_set_del_item(LSM* self, PyObject* key, PyObject* value) {
 		int rc;
 
 		Py_BEGIN_ALLOW_THREADS
-		LSM_MutexLock(self);
+		LSM_WriteLock(self);
+		pylsm_csr_pool_drain(self);
 		rc = lsm_delete_range(
 			self->lsm,
 			pStart, (int) nStart,
 			pStop, (int) nStop
 		);
-		LSM_MutexLeave(self);
+		self->key_count_valid = 0;
+		LSM_WriteUnlock(self);
 		Py_END_ALLOW_THREADS
 
 		Py_DECREF(slice->start);
@@ -1856,10 +4081,13 @@ static int LSM_set_del_item(LSM* self, PyObject* key, PyObject* value) {
 
 		if (pylsm_error(rc)) return -1;
 
+		PYLSM_STAT_ADD(self, stat_deletes, 1);
 		return 0;
 	}
 
-	if (str_or_bytes_check(self->binary, key, &pKey, &nKey)) return -1;
+	char packed[PYLSM_INT_KEY_SIZE];
+
+	if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) return -1;
 	if (value != NULL) { if (str_or_bytes_check(self->binary, value, &pVal, &nVal)) return -1; }
 
 	if (nKey >= INT_MAX) {
@@ -1872,13 +4100,14 @@ static int LSM_set_del_item(LSM* self, PyObject* key, PyObject* value) {
 	}
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_WriteLock(self);
 	if (pVal == NULL) {
-		rc = pylsm_delitem(self->lsm, pKey, (int) nKey);
+		rc = pylsm_delitem(self, pKey, (int) nKey);
+		if (rc == 0 && self->key_count_valid) self->key_count--;
 	} else {
-		rc = lsm_insert(self->lsm, pKey, (int) nKey, pVal, (int) nVal);
+		rc = pylsm_insert_tracked(self, pKey, (int) nKey, pVal, (int) nVal);
 	}
-	LSM_MutexLeave(self);
+	LSM_WriteUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (rc == -1) {
@@ -1892,6 +4121,7 @@ static int LSM_set_del_item(LSM* self, PyObject* key, PyObject* value) {
 
 	if (pylsm_error(rc)) return -1;
 
+	pylsm_worker_notify(self);
 	return 0;
 }
 
@@ -1901,8 +4131,9 @@ static int LSM_contains(LSM *self, PyObject *key) {
 
 	const char* pKey = NULL;
 	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
 
-	if (str_or_bytes_check(self->binary, key, (const char**) &pKey, &nKey)) return 0;
+	if (pylsm_key_check(self->binary, key, (const char**) &pKey, &nKey, packed)) return 0;
 
 	if (nKey >= INT_MAX) {
 		PyErr_SetString(PyExc_OverflowError, "length of key is too large");
@@ -1911,10 +4142,12 @@ static int LSM_contains(LSM *self, PyObject *key) {
 
 	int rc;
 
+	PYLSM_STAT_ADD(self, stat_gets, 1);
+
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
-	rc = pylsm_contains(self->lsm, pKey, (int) nKey);
-	LSM_MutexLeave(self);
+	LSM_ReadLock(self);
+	rc = pylsm_contains(self, pKey, (int) nKey);
+	LSM_ReadUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (rc == -1) return 0;
@@ -1930,8 +4163,10 @@ static PyObject* LSM_compress_get(LSM* self) {
 		case PY_LSM_COMPRESSOR_NONE:
 			Py_RETURN_NONE;
 		case PY_LSM_COMPRESSOR_LZ4:
+		case PY_LSM_COMPRESSOR_LZ4_ADAPTIVE:
 			return Py_BuildValue("s", "lz4");
 		case PY_LSM_COMPRESSOR_ZSTD:
+		case PY_LSM_COMPRESSOR_ZSTD_ADAPTIVE:
 			return Py_BuildValue("s", "zstd");
 	}
 
@@ -1949,15 +4184,105 @@ static PyObject* LSM_repr(LSM *self) {
 }
 
 
+// Open an additional read-only connection to the same database file.
+// The snapshot pays no flush/merge on open and carries the source
+// configuration over, so N threads can scan disjoint ranges each on
+// their own lsm_db without sharing the source connection lock.
+static PyObject* LSM_snapshot(LSM *self) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	int rc = LSM_OK;
+
+	// Make everything written through this connection visible to the
+	// read-only one, which only sees the last checkpointed state.
+	if (!self->readonly && self->tx_level == 0) {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_WriteLock(self);
+		rc = lsm_flush(self->lsm);
+		if (rc == LSM_OK) rc = lsm_checkpoint(self->lsm, NULL);
+		LSM_WriteUnlock(self);
+		Py_END_ALLOW_THREADS
+
+		if (pylsm_error(rc)) return NULL;
+	}
+
+	PyObject *kwargs = Py_BuildValue(
+		"{sOsOsOsOsisi}",
+		"readonly", Py_True,
+		"binary", self->binary ? Py_True : Py_False,
+		"multiple_processes", self->multiple_processes ? Py_True : Py_False,
+		"mmap", self->mmap ? Py_True : Py_False,
+		"block_size", self->block_size,
+		"page_size", self->page_size
+	);
+	if (kwargs == NULL) return NULL;
+
+	if (self->binary == PY_LSM_KEY_INT) {
+		PyObject* mode = PyUnicode_FromString("int");
+		if (mode == NULL) { Py_DECREF(kwargs); return NULL; }
+		rc = PyDict_SetItemString(kwargs, "binary", mode);
+		Py_DECREF(mode);
+		if (rc) { Py_DECREF(kwargs); return NULL; }
+	}
+
+	if (self->compressed) {
+		PyObject* compress = LSM_compress_get(self);
+		if (compress == NULL) { Py_DECREF(kwargs); return NULL; }
+		rc = PyDict_SetItemString(kwargs, "compress", compress);
+		Py_DECREF(compress);
+		if (rc) { Py_DECREF(kwargs); return NULL; }
+
+		if (self->compress_level != PYLSM_DEFAULT_COMPRESS_LEVEL) {
+			PyObject* level = PyLong_FromLong(self->compress_level);
+			if (level == NULL) { Py_DECREF(kwargs); return NULL; }
+			rc = PyDict_SetItemString(kwargs, "compress_level", level);
+			Py_DECREF(level);
+			if (rc) { Py_DECREF(kwargs); return NULL; }
+		}
+
+		if (self->compress_dict != NULL) {
+			PyObject* cdict = PyBytes_FromStringAndSize(
+				self->compress_dict, self->compress_dict_len
+			);
+			if (cdict == NULL) { Py_DECREF(kwargs); return NULL; }
+			rc = PyDict_SetItemString(kwargs, "compress_dict", cdict);
+			Py_DECREF(cdict);
+			if (rc) { Py_DECREF(kwargs); return NULL; }
+		}
+
+		if (self->compress_adaptive) {
+			rc = PyDict_SetItemString(
+				kwargs, "compress_adaptive", Py_True
+			);
+			if (rc) { Py_DECREF(kwargs); return NULL; }
+		}
+	}
+
+	PyObject *args = Py_BuildValue("(s)", self->path);
+	if (args == NULL) { Py_DECREF(kwargs); return NULL; }
+
+	PyObject *snapshot = PyObject_Call((PyObject *) &LSMType, args, kwargs);
+	Py_DECREF(args);
+	Py_DECREF(kwargs);
+	if (snapshot == NULL) return NULL;
+
+	PyObject *opened = PyObject_CallMethod(snapshot, "open", NULL);
+	if (opened == NULL) { Py_DECREF(snapshot); return NULL; }
+	Py_DECREF(opened);
+
+	return snapshot;
+}
+
+
 static Py_ssize_t LSM_length(LSM *self) {
 	Py_ssize_t result = 0;
 	Py_ssize_t rc = 0;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self);
+	LSM_ReadLock(self);
 
-	rc = pylsm_length(self->lsm, &result);
-	LSM_MutexLeave(self);
+	rc = pylsm_length_cached(self, &result);
+	LSM_ReadUnlock(self);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(rc)) return -1;
@@ -1965,6 +4290,30 @@ static Py_ssize_t LSM_length(LSM *self) {
 }
 
 
+static PyObject* LSM_count(LSM *self, PyObject *args, PyObject *kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"exact", NULL};
+
+	char exact = 0;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|p", kwlist, &exact)) return NULL;
+
+	Py_ssize_t result = 0;
+	Py_ssize_t rc = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	if (exact) self->key_count_valid = 0;
+	rc = pylsm_length_cached(self, &result);
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+	return Py_BuildValue("n", result);
+}
+
+
 static LSMIterView* LSM_keys(LSM* self) {
 	if (pylsm_ensure_opened(self)) return NULL;
 
@@ -2002,117 +4351,839 @@ static LSMIterView* LSM_iter(LSM* self) {
 static PyObject* LSM_update(LSM* self, PyObject *args) {
 	if (pylsm_ensure_writable(self)) return NULL;
 
-	PyObject * value = NULL;
+	PyObject * source = NULL;
 
-	if (!PyArg_ParseTuple(args, "O", &value)) return NULL;
-	if (!PyMapping_Check(value)) {
-		PyErr_Format(
-			PyExc_ValueError,
-			"Mapping expected not %R",
-			PyObject_Type(value)
-		);
-		return NULL;
-	}
+	if (!PyArg_ParseTuple(args, "O", &source)) return NULL;
 
-	PyObject* items = PyMapping_Items(value);
+	// Accept a mapping or any iterable of key/value pairs
+	PyObject* items;
 
-	if (!PyList_Check(items)) {
-		PyErr_Format(
-			PyExc_ValueError,
-			"Iterable expected not %R",
-			PyObject_Type(items)
-		);
-		return NULL;
+	if (PyDict_Check(source)) {
+		items = PyMapping_Items(source);
+	} else if (PyObject_HasAttrString(source, "items")) {
+		items = PyObject_CallMethod(source, "items", NULL);
+	} else {
+		items = source;
+		Py_INCREF(items);
 	}
 
-	Py_ssize_t mapping_size = PyMapping_Length(value);
-
-	PyObject **keys_objects = PyMem_Calloc(mapping_size, sizeof(PyObject*));
-	PyObject **values_objects = PyMem_Calloc(mapping_size, sizeof(PyObject*));
-	char **keys = PyMem_Calloc(mapping_size, sizeof(char*));
-	char **values = PyMem_Calloc(mapping_size, sizeof(char*));
-	Py_ssize_t *key_sizes = PyMem_Calloc(mapping_size, sizeof(Py_ssize_t*));
-	Py_ssize_t *value_sizes = PyMem_Calloc(mapping_size, sizeof(Py_ssize_t*));
+	if (items == NULL) return NULL;
 
-	PyObject *item;
-	int count = 0;
 	PyObject *iterator = PyObject_GetIter(items);
+	Py_DECREF(items);
 
-	PyObject* obj;
+	if (iterator == NULL) return NULL;
 
+	// Scratch arrays are chunk-sized, not source-sized: the source is
+	// consumed in chunks and each chunk is applied in one transaction
+	// under a single mutex/GIL-release window.
+	PyObject **item_refs = PyMem_Calloc(PYLSM_UPDATE_CHUNK, sizeof(PyObject*));
+	const char **keys = PyMem_Calloc(PYLSM_UPDATE_CHUNK, sizeof(char*));
+	const char **values = PyMem_Calloc(PYLSM_UPDATE_CHUNK, sizeof(char*));
+	Py_ssize_t *key_sizes = PyMem_Calloc(PYLSM_UPDATE_CHUNK, sizeof(Py_ssize_t));
+	Py_ssize_t *value_sizes = PyMem_Calloc(PYLSM_UPDATE_CHUNK, sizeof(Py_ssize_t));
+	char *packed_keys = PyMem_Calloc(PYLSM_UPDATE_CHUNK, PYLSM_INT_KEY_SIZE);
+
+	int rc = 0;
 	unsigned short is_ok = 1;
+	unsigned short done = 0;
 
-	while ((item = PyIter_Next(iterator))) {
-		if (PyTuple_Size(item) != 2) {
-			Py_DECREF(item);
-			PyErr_Format(
-				PyExc_ValueError,
-				"Mapping items must be tuple with pair not %R",
-				item
-			);
-			is_ok = 0;
-			break;
-		}
+	while (is_ok && !done) {
+		Py_ssize_t chunk_len = 0;
+		PyObject *item;
 
-		obj = PyTuple_GET_ITEM(item, 0);
-		if (str_or_bytes_check(self->binary, obj, (const char**) &keys[count], &key_sizes[count])) {
+		while (chunk_len < PYLSM_UPDATE_CHUNK && (item = PyIter_Next(iterator))) {
+			PyObject *pair = PySequence_Fast(
+				item, "update() items must be key/value pairs"
+			);
 			Py_DECREF(item);
-			is_ok = 0;
-			break;
+
+			if (pair == NULL) { is_ok = 0; break; }
+
+			if (PySequence_Fast_GET_SIZE(pair) != 2) {
+				PyErr_Format(
+					PyExc_ValueError,
+					"Mapping items must be tuple with pair not %R",
+					pair
+				);
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			if (pylsm_key_check(
+				self->binary, PySequence_Fast_GET_ITEM(pair, 0),
+				&keys[chunk_len], &key_sizes[chunk_len],
+				packed_keys + chunk_len * PYLSM_INT_KEY_SIZE
+			)) { Py_DECREF(pair); is_ok = 0; break; }
+
+			if (key_sizes[chunk_len] >= INT_MAX) {
+				PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			if (str_or_bytes_check(
+				self->binary, PySequence_Fast_GET_ITEM(pair, 1),
+				&values[chunk_len], &value_sizes[chunk_len]
+			)) { Py_DECREF(pair); is_ok = 0; break; }
+
+			if (value_sizes[chunk_len] >= INT_MAX) {
+				PyErr_SetString(PyExc_OverflowError, "length of value is too large");
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			// the pair keeps both borrowed buffers alive
+			item_refs[chunk_len] = pair;
+			chunk_len++;
 		}
 
-		if (key_sizes[count] >= INT_MAX) {
-			PyErr_SetString(PyExc_OverflowError, "length of key is too large");
-			return NULL;
+		if (PyErr_Occurred()) is_ok = 0;
+		if (chunk_len < PYLSM_UPDATE_CHUNK) done = 1;
+
+		if (is_ok && chunk_len > 0) {
+			Py_BEGIN_ALLOW_THREADS
+			LSM_WriteLock(self);
+
+			if (!(rc = lsm_begin(self->lsm, self->tx_level + 1))) {
+				for (Py_ssize_t i = 0; i < chunk_len; i++) {
+					if ((rc = pylsm_insert_tracked(
+						self,
+						keys[i], (int) key_sizes[i],
+						values[i], (int) value_sizes[i]
+					))) break;
+				}
+
+				if (rc == LSM_OK) {
+					rc = lsm_commit(self->lsm, self->tx_level);
+				} else {
+					lsm_rollback(self->lsm, self->tx_level);
+				}
+			}
+
+			LSM_WriteUnlock(self);
+			Py_END_ALLOW_THREADS
+
+			if (pylsm_error(rc)) is_ok = 0;
+			pylsm_worker_notify(self);
 		}
 
-		keys_objects[count] = obj;
-		Py_INCREF(obj);
+		for (Py_ssize_t i = 0; i < chunk_len; i++) Py_CLEAR(item_refs[i]);
+	}
 
-		obj = PyTuple_GET_ITEM(item, 1);
-		if (str_or_bytes_check(self->binary, obj, (const char**) &values[count], &value_sizes[count])) {
-			Py_DECREF(item);
-			is_ok = 0;
-			break;
+	PyMem_Free(key_sizes);
+	PyMem_Free(value_sizes);
+	PyMem_Free(keys);
+	PyMem_Free(values);
+	PyMem_Free(item_refs);
+	PyMem_Free(packed_keys);
+
+	Py_CLEAR(iterator);
+
+	if (is_ok) {
+		Py_RETURN_NONE;
+	} else {
+		return NULL;
+	}
+}
+
+
+// Page-cache control for the database file. "sequential" before a full
+// scan buys kernel readahead, "random" keeps point-lookup services from
+// polluting the cache with speculative pages, "willneed" prefetches and
+// "dontneed" drops a cold range. The wrapper cannot translate a key
+// range into file offsets, so the optional range is expressed in bytes;
+// the default covers the whole file. The advice applies to the file in
+// the page cache, so a private descriptor is enough — the engine's own
+// descriptor is left alone.
+static PyObject* LSM_advise(LSM *self, PyObject *args, PyObject *kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"mode", "offset", "length", NULL};
+
+	const char *mode;
+	Py_ssize_t offset = 0;
+	Py_ssize_t length = 0;
+
+	if (!PyArg_ParseTupleAndKeywords(
+		args, kwds, "s|nn", kwlist, &mode, &offset, &length
+	)) return NULL;
+
+#ifdef POSIX_FADV_SEQUENTIAL
+	int advice;
+
+	if (strcmp(mode, "sequential") == 0) {
+		advice = POSIX_FADV_SEQUENTIAL;
+	} else if (strcmp(mode, "random") == 0) {
+		advice = POSIX_FADV_RANDOM;
+	} else if (strcmp(mode, "willneed") == 0) {
+		advice = POSIX_FADV_WILLNEED;
+	} else if (strcmp(mode, "dontneed") == 0) {
+		advice = POSIX_FADV_DONTNEED;
+	} else {
+		PyErr_Format(
+			PyExc_ValueError,
+			"mode must be \"sequential\", \"random\", \"willneed\" "
+			"or \"dontneed\", not \"%s\"",
+			mode
+		);
+		return NULL;
+	}
+
+	if (offset < 0 || length < 0) {
+		PyErr_SetString(
+			PyExc_ValueError, "offset and length must not be negative"
+		);
+		return NULL;
+	}
+
+	int fd = -1;
+	int rc = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	fd = open(self->path, O_RDONLY);
+	if (fd >= 0) {
+		rc = posix_fadvise(fd, offset, length, advice);
+		close(fd);
+	}
+	Py_END_ALLOW_THREADS
+
+	if (fd < 0) {
+		return PyErr_SetFromErrnoWithFilename(PyExc_OSError, self->path);
+	}
+	if (rc != 0) {
+		errno = rc;
+		return PyErr_SetFromErrnoWithFilename(PyExc_OSError, self->path);
+	}
+
+	Py_RETURN_NONE;
+#else
+	PyErr_SetString(
+		PyExc_NotImplementedError,
+		"posix_fadvise is not available on this platform"
+	);
+	return NULL;
+#endif
+}
+
+
+// Exact number of keys in [start, stop] via a value-skipping cursor
+// walk under one lock/GIL-release window — no entry decoding, no
+// Python objects, unlike iterating a slice for the same answer.
+static PyObject* LSM_count_range(LSM* self, PyObject* args) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	PyObject *start, *stop;
+	const char *pStart, *pStop;
+	Py_ssize_t nStart, nStop;
+	char packed_start[PYLSM_INT_KEY_SIZE];
+	char packed_stop[PYLSM_INT_KEY_SIZE];
+	Py_ssize_t count = 0;
+	int rc;
+
+	if (!PyArg_ParseTuple(args, "OO", &start, &stop)) return NULL;
+	if (pylsm_key_check(self->binary, start, &pStart, &nStart, packed_start)) return NULL;
+	if (pylsm_key_check(self->binary, stop, &pStop, &nStop, packed_stop)) return NULL;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	rc = pylsm_range_scan(self, pStart, nStart, pStop, nStop, &count, NULL);
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+	return PyLong_FromSsize_t(count);
+}
+
+
+// Payload bytes (keys plus values) stored in [start, stop]. The engine
+// publishes no per-range page metadata, so the sizes are summed in the
+// same single-pass walk count_range uses; values are sized but never
+// copied out.
+static PyObject* LSM_estimate_size(LSM* self, PyObject* args) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	PyObject *start, *stop;
+	const char *pStart, *pStop;
+	Py_ssize_t nStart, nStop;
+	char packed_start[PYLSM_INT_KEY_SIZE];
+	char packed_stop[PYLSM_INT_KEY_SIZE];
+	Py_ssize_t count = 0;
+	Py_ssize_t nbytes = 0;
+	int rc;
+
+	if (!PyArg_ParseTuple(args, "OO", &start, &stop)) return NULL;
+	if (pylsm_key_check(self->binary, start, &pStart, &nStart, packed_start)) return NULL;
+	if (pylsm_key_check(self->binary, stop, &pStop, &nStop, packed_stop)) return NULL;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	rc = pylsm_range_scan(self, pStart, nStart, pStop, nStop, &count, &nbytes);
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+	return PyLong_FromSsize_t(nbytes);
+}
+
+
+// One-call paginated range read: the seek and the row collection all
+// happen inside a single lock window, so a limit-100 page costs one
+// lock round-trip instead of ~200 cursor method calls. Bounds are
+// inclusive, matching slices and count_range(); a negative limit
+// returns the whole range.
+static PyObject* LSM_read_range(LSM* self, PyObject* args, PyObject* kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"start", "stop", "limit", NULL};
+
+	PyObject *start, *stop;
+	const char *pStart, *pStop;
+	Py_ssize_t nStart, nStop;
+	char packed_start[PYLSM_INT_KEY_SIZE];
+	char packed_stop[PYLSM_INT_KEY_SIZE];
+	Py_ssize_t limit = -1;
+	LSMPrefetchItem *items = NULL;
+	Py_ssize_t count = 0;
+	int rc;
+
+	if (!PyArg_ParseTupleAndKeywords(
+		args, kwds, "OO|n", kwlist, &start, &stop, &limit
+	)) return NULL;
+
+	if (pylsm_key_check(self->binary, start, &pStart, &nStart, packed_start)) return NULL;
+	if (pylsm_key_check(self->binary, stop, &pStop, &nStop, packed_stop)) return NULL;
+
+	if (nStart >= INT_MAX || nStop >= INT_MAX) {
+		PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	rc = pylsm_read_range_collect(
+		self, pStart, nStart, pStop, nStop, limit, &items, &count
+	);
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+
+	PYLSM_STAT_ADD(self, stat_gets, count);
+	return pylsm_items_to_list(items, count, self->binary);
+}
+
+
+// Collect the boundary keys for n count-balanced partitions of the
+// whole keyspace. The engine publishes no per-range key statistics,
+// so the split is found with two cursor walks: one to count, one to
+// copy out the keys sitting at the computed boundaries. Boundary keys
+// are malloc'ed; the caller owns them. *pCount is clamped to the
+// number of stored keys so small databases never yield empty ranges.
+static int pylsm_partitions_collect(
+	LSM* self, Py_ssize_t n,
+	char** pStarts, int* nStarts, char** pStops, int* nStops,
+	Py_ssize_t* pCount
+) {
+	int rc;
+	lsm_cursor* cursor;
+	Py_ssize_t total = 0;
+
+	*pCount = 0;
+
+	if ((rc = pylsm_csr_acquire(self, &cursor))) return rc;
+
+	for (
+		rc = lsm_csr_first(cursor);
+		rc == LSM_OK && lsm_csr_valid(cursor);
+		rc = lsm_csr_next(cursor)
+	) total++;
+
+	if (rc != LSM_OK || total == 0) {
+		pylsm_csr_release(self, cursor);
+		return rc;
+	}
+
+	if (n > total) n = total;
+
+	Py_ssize_t idx = 0;
+	Py_ssize_t part = 0;
+
+	for (
+		rc = lsm_csr_first(cursor);
+		rc == LSM_OK && lsm_csr_valid(cursor) && part < n;
+		rc = lsm_csr_next(cursor), idx++
+	) {
+		Py_ssize_t lo = part * total / n;
+		Py_ssize_t hi = (part + 1) * total / n - 1;
+
+		if (idx != lo && idx != hi) continue;
+
+		const char* pKey = NULL;
+		int nKey = 0;
+
+		if ((rc = lsm_csr_key(cursor, (const void**) &pKey, &nKey))) break;
+
+		if (idx == lo) {
+			if ((pStarts[part] = malloc(nKey)) == NULL) { rc = LSM_NOMEM; break; }
+			memcpy(pStarts[part], pKey, nKey);
+			nStarts[part] = nKey;
 		}
 
-		if (value_sizes[count] >= INT_MAX) {
-			PyErr_SetString(PyExc_OverflowError, "length of value is too large");
-			return NULL;
+		if (idx == hi) {
+			if ((pStops[part] = malloc(nKey)) == NULL) { rc = LSM_NOMEM; break; }
+			memcpy(pStops[part], pKey, nKey);
+			nStops[part] = nKey;
+			part++;
 		}
+	}
 
-		values_objects[count] = obj;
-		Py_INCREF(obj);
+	pylsm_csr_release(self, cursor);
 
-		Py_DECREF(item);
-		count++;
-    }
+	if (rc == LSM_OK) *pCount = part;
+	return rc;
+}
 
-    int rc;
 
-	if (is_ok) {
+// Split the keyspace into n ranges holding roughly the same number of
+// keys, returned as inclusive (start, stop) bounds ready to feed
+// read_range(), slices or count_range(). Parallel dump tooling hands
+// one range to each worker connection so a scan scales with cores.
+static PyObject* LSM_partitions(LSM* self, PyObject* args, PyObject* kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"n", NULL};
+
+	Py_ssize_t n = 0;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "n", kwlist, &n)) return NULL;
+
+	if (n < 1) {
+		PyErr_Format(
+			PyExc_ValueError,
+			"n must be a positive integer. Not %zd", n
+		);
+		return NULL;
+	}
+
+	char** pStarts = PyMem_Calloc(n, sizeof(char*));
+	int* nStarts = PyMem_Calloc(n, sizeof(int));
+	char** pStops = PyMem_Calloc(n, sizeof(char*));
+	int* nStops = PyMem_Calloc(n, sizeof(int));
+	Py_ssize_t count = 0;
+	Py_ssize_t i;
+	int rc = LSM_OK;
+
+	if (!pStarts || !nStarts || !pStops || !nStops) {
+		rc = LSM_NOMEM;
+	} else {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_ReadLock(self);
+		rc = pylsm_partitions_collect(
+			self, n, pStarts, nStarts, pStops, nStops, &count
+		);
+		LSM_ReadUnlock(self);
+		Py_END_ALLOW_THREADS
+	}
+
+	PyObject* result = NULL;
+
+	if (!pylsm_error(rc)) result = PyList_New(count);
+
+	for (i = 0; result != NULL && i < count; i++) {
+		PyObject* start = pylsm_key_materialize(
+			pStarts[i], nStarts[i], self->binary
+		);
+		PyObject* stop = start == NULL ? NULL : pylsm_key_materialize(
+			pStops[i], nStops[i], self->binary
+		);
+		PyObject* pair = stop == NULL ? NULL : PyTuple_Pack(2, start, stop);
+
+		Py_XDECREF(start);
+		Py_XDECREF(stop);
+
+		if (pair == NULL) {
+			Py_CLEAR(result);
+			break;
+		}
+
+		PyList_SET_ITEM(result, i, pair);
+	}
+
+	for (i = 0; i < n; i++) {
+		if (pStarts != NULL && pStarts[i] != NULL) free(pStarts[i]);
+		if (pStops != NULL && pStops[i] != NULL) free(pStops[i]);
+	}
+
+	PyMem_Free(pStarts);
+	PyMem_Free(nStarts);
+	PyMem_Free(pStops);
+	PyMem_Free(nStops);
+
+	return result;
+}
+
+
+// Hot backup: stream every entry into a fresh database at dest_path
+// while writers continue. A cursor opened on the source pins a
+// consistent snapshot for the whole run, so the copy sees one point in
+// time no matter how long it takes; the shared lock is dropped between
+// chunks so writers only wait for one chunk window at a time. The
+// destination receives the keys in sorted order with a maximal
+// autoflush budget, which is the same ingestion profile bulk_load
+// uses, and is compacted before close.
+static PyObject* LSM_backup(LSM* self, PyObject* args, PyObject* kwds) {
+	if (pylsm_ensure_opened(self)) return NULL;
+
+	static char *kwlist[] = {"path", "chunk_size", "progress", NULL};
+
+	PyObject *pyPath;
+	Py_ssize_t chunk_size = PYLSM_BACKUP_CHUNK_DEFAULT;
+	PyObject *progress = NULL;
+
+	if (!PyArg_ParseTupleAndKeywords(
+		args, kwds, "O|nO", kwlist, &pyPath, &chunk_size, &progress
+	)) return NULL;
+
+	if (chunk_size < 4096) {
+		PyErr_Format(
+			PyExc_ValueError,
+			"chunk_size must be at least 4096. Not %zd", chunk_size
+		);
+		return NULL;
+	}
+
+	if (progress == Py_None) progress = NULL;
+	if (progress != NULL && !PyCallable_Check(progress)) {
+		PyErr_Format(PyExc_ValueError, "object %R is not callable", progress);
+		return NULL;
+	}
+
+	if (PyUnicode_Check(pyPath)) {
+		Py_INCREF(pyPath);
+	} else {
+		pyPath = PyObject_Str(pyPath);
+		if (pyPath == NULL) return NULL;
+	}
+
+	const char *path = PyUnicode_AsUTF8(pyPath);
+	if (path == NULL) { Py_DECREF(pyPath); return NULL; }
+
+	lsm_db *dst = NULL;
+	lsm_cursor *cursor = NULL;
+	int rc;
+	int autoflush_bulk = LSM_MAX_AUTOFLUSH;
+	int autowork_off = 0;
+
+	if (pylsm_error(lsm_new(NULL, &dst))) { Py_DECREF(pyPath); return NULL; }
+
+	rc = lsm_config(dst, LSM_CONFIG_BLOCK_SIZE, &self->block_size);
+	if (rc == LSM_OK && self->compressed) {
+		rc = lsm_config(dst, LSM_CONFIG_SET_COMPRESSION, &self->lsm_compress);
+	}
+	if (rc == LSM_OK) rc = lsm_config(dst, LSM_CONFIG_PAGE_SIZE, &self->page_size);
+	if (rc == LSM_OK) rc = lsm_config(dst, LSM_CONFIG_AUTOFLUSH, &autoflush_bulk);
+	if (rc == LSM_OK) rc = lsm_config(dst, LSM_CONFIG_AUTOWORK, &autowork_off);
+	if (rc == LSM_OK) rc = lsm_open(dst, path);
+
+	if (pylsm_error(rc)) {
+		lsm_close(dst);
+		Py_DECREF(pyPath);
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	rc = pylsm_csr_open_shared(self, &cursor);
+	if (rc == LSM_OK) rc = lsm_csr_first(cursor);
+	LSM_ReadUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) {
+		lsm_close(dst);
+		Py_DECREF(pyPath);
+		return NULL;
+	}
+
+	Py_ssize_t total_entries = 0;
+	Py_ssize_t total_bytes = 0;
+	unsigned short is_ok = 1;
+	unsigned short done = 0;
+
+	while (is_ok && !done) {
+		Py_ssize_t window_bytes = 0;
+
 		Py_BEGIN_ALLOW_THREADS
-		LSM_MutexLock(self);
-		for (int i=0; i < mapping_size; i++) {
-			if ((rc = lsm_insert(self->lsm, keys[i], (int) key_sizes[i], values[i], (int) value_sizes[i]))) break;
+		LSM_ReadLock(self);
+
+		while (lsm_csr_valid(cursor) && window_bytes < chunk_size) {
+			const void *pKey;
+			const void *pVal;
+			int nKey, nVal;
+
+			if ((rc = lsm_csr_key(cursor, &pKey, &nKey))) break;
+			if ((rc = lsm_csr_value(cursor, &pVal, &nVal))) break;
+			if ((rc = lsm_insert(dst, pKey, nKey, pVal, nVal))) break;
+
+			window_bytes += nKey + nVal;
+			total_entries++;
+
+			if ((rc = lsm_csr_next(cursor))) break;
 		}
-		LSM_MutexLeave(self);
+
+		if (rc == LSM_OK && !lsm_csr_valid(cursor)) done = 1;
+
+		LSM_ReadUnlock(self);
 		Py_END_ALLOW_THREADS
 
-		if (pylsm_error(rc)) is_ok = 0;
+		total_bytes += window_bytes;
+
+		if (pylsm_error(rc)) { is_ok = 0; break; }
+
+		if (progress != NULL) {
+			PyObject *res = PyObject_CallFunction(
+				progress, "nn", total_entries, total_bytes
+			);
+			if (res == NULL) { is_ok = 0; break; }
+			Py_DECREF(res);
+		}
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self);
+	pylsm_csr_close_shared(self, cursor);
+	LSM_ReadUnlock(self);
+
+	if (is_ok) {
+		rc = lsm_flush(dst);
+		if (rc == LSM_OK) {
+			rc = lsm_work(dst, self->automerge, self->page_size, NULL);
+		}
+		if (rc == LSM_OK) rc = lsm_checkpoint(dst, NULL);
+	}
+
+	lsm_close(dst);
+	Py_END_ALLOW_THREADS
+
+	Py_DECREF(pyPath);
+
+	if (!is_ok) return NULL;
+	if (pylsm_error(rc)) return NULL;
+	return PyLong_FromSsize_t(total_entries);
+}
+
+
+// Ingestion fast path for pre-sorted data. Regular inserts push
+// everything through the live in-memory tree with the configured
+// autoflush budget, triggering flush/merge churn mid-load; here the
+// budget is raised to the maximum, autowork is switched off, and
+// flush/merge runs explicitly once per chunk while the data is still
+// hot. Sort order is verified with a memcmp against the previous key —
+// lsm1 orders keys by memcmp, so this is exactly the engine's order.
+static PyObject* LSM_bulk_load(LSM* self, PyObject *args) {
+	if (pylsm_ensure_writable(self)) return NULL;
+
+	PyObject * source = NULL;
+
+	if (!PyArg_ParseTuple(args, "O", &source)) return NULL;
+
+	if (self->tx_level != 0) {
+		PyErr_SetString(
+			PyExc_RuntimeError,
+			"bulk_load can not run inside an open transaction"
+		);
+		return NULL;
+	}
+
+	PyObject *iterator = PyObject_GetIter(source);
+	if (iterator == NULL) return NULL;
+
+	int rc = 0;
+	int autoflush_bulk = LSM_MAX_AUTOFLUSH;
+	int autowork_off = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_WriteLock(self);
+	rc = lsm_config(self->lsm, LSM_CONFIG_AUTOFLUSH, &autoflush_bulk);
+	if (rc == LSM_OK) {
+		rc = lsm_config(self->lsm, LSM_CONFIG_AUTOWORK, &autowork_off);
+	}
+	LSM_WriteUnlock(self);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) {
+		Py_DECREF(iterator);
+		return NULL;
+	}
+
+	PyObject **item_refs = PyMem_Calloc(PYLSM_BULK_CHUNK, sizeof(PyObject*));
+	const char **keys = PyMem_Calloc(PYLSM_BULK_CHUNK, sizeof(char*));
+	const char **values = PyMem_Calloc(PYLSM_BULK_CHUNK, sizeof(char*));
+	Py_ssize_t *key_sizes = PyMem_Calloc(PYLSM_BULK_CHUNK, sizeof(Py_ssize_t));
+	Py_ssize_t *value_sizes = PyMem_Calloc(PYLSM_BULK_CHUNK, sizeof(Py_ssize_t));
+	char *packed_keys = PyMem_Calloc(PYLSM_BULK_CHUNK, PYLSM_INT_KEY_SIZE);
+
+	// The previous key survives the chunk boundary in its own buffer:
+	// the borrowed chunk buffers die when item_refs is cleared.
+	char *prev_key = NULL;
+	Py_ssize_t prev_len = 0;
+	Py_ssize_t prev_cap = 0;
+
+	unsigned short is_ok = 1;
+	unsigned short done = 0;
+
+	while (is_ok && !done) {
+		Py_ssize_t chunk_len = 0;
+		PyObject *item;
+
+		while (chunk_len < PYLSM_BULK_CHUNK && (item = PyIter_Next(iterator))) {
+			PyObject *pair = PySequence_Fast(
+				item, "bulk_load() items must be key/value pairs"
+			);
+			Py_DECREF(item);
+
+			if (pair == NULL) { is_ok = 0; break; }
+
+			if (PySequence_Fast_GET_SIZE(pair) != 2) {
+				PyErr_Format(
+					PyExc_ValueError,
+					"Mapping items must be tuple with pair not %R",
+					pair
+				);
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			if (pylsm_key_check(
+				self->binary, PySequence_Fast_GET_ITEM(pair, 0),
+				&keys[chunk_len], &key_sizes[chunk_len],
+				packed_keys + chunk_len * PYLSM_INT_KEY_SIZE
+			)) { Py_DECREF(pair); is_ok = 0; break; }
+
+			if (key_sizes[chunk_len] >= INT_MAX) {
+				PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			if (str_or_bytes_check(
+				self->binary, PySequence_Fast_GET_ITEM(pair, 1),
+				&values[chunk_len], &value_sizes[chunk_len]
+			)) { Py_DECREF(pair); is_ok = 0; break; }
+
+			if (value_sizes[chunk_len] >= INT_MAX) {
+				PyErr_SetString(PyExc_OverflowError, "length of value is too large");
+				Py_DECREF(pair);
+				is_ok = 0;
+				break;
+			}
+
+			if (prev_key != NULL) {
+				Py_ssize_t n = prev_len < key_sizes[chunk_len]
+					? prev_len : key_sizes[chunk_len];
+				int cmp = memcmp(prev_key, keys[chunk_len], n);
+
+				if (cmp > 0 || (cmp == 0 && prev_len > key_sizes[chunk_len])) {
+					PyErr_SetString(
+						PyExc_ValueError,
+						"bulk_load requires keys sorted in ascending order"
+					);
+					Py_DECREF(pair);
+					is_ok = 0;
+					break;
+				}
+			}
+
+			if (key_sizes[chunk_len] > prev_cap) {
+				char *grown = PyMem_Realloc(prev_key, key_sizes[chunk_len]);
+				if (grown == NULL) {
+					PyErr_NoMemory();
+					Py_DECREF(pair);
+					is_ok = 0;
+					break;
+				}
+				prev_key = grown;
+				prev_cap = key_sizes[chunk_len];
+			}
+			memcpy(prev_key, keys[chunk_len], key_sizes[chunk_len]);
+			prev_len = key_sizes[chunk_len];
+
+			// the pair keeps both borrowed buffers alive
+			item_refs[chunk_len] = pair;
+			chunk_len++;
+		}
+
+		if (PyErr_Occurred()) is_ok = 0;
+		if (chunk_len < PYLSM_BULK_CHUNK) done = 1;
+
+		if (is_ok && chunk_len > 0) {
+			Py_BEGIN_ALLOW_THREADS
+			LSM_WriteLock(self);
+
+			if (!(rc = lsm_begin(self->lsm, self->tx_level + 1))) {
+				pylsm_csr_pool_drain(self);
+
+				for (Py_ssize_t i = 0; i < chunk_len; i++) {
+					if ((rc = lsm_insert(
+						self->lsm,
+						keys[i], (int) key_sizes[i],
+						values[i], (int) value_sizes[i]
+					))) break;
+					pylsm_bloom_add(self, keys[i], (int) key_sizes[i]);
+				}
+
+				if (rc == LSM_OK) {
+					rc = lsm_commit(self->lsm, self->tx_level);
+				} else {
+					lsm_rollback(self->lsm, self->tx_level);
+				}
+			}
+
+			// Segment boundary: push the chunk out of the in-memory
+			// tree and merge before the next one arrives.
+			if (rc == LSM_OK) rc = lsm_flush(self->lsm);
+			if (rc == LSM_OK) {
+				rc = lsm_work(self->lsm, self->automerge, self->page_size, NULL);
+			}
+
+			LSM_WriteUnlock(self);
+			Py_END_ALLOW_THREADS
+
+			if (rc == LSM_OK) PYLSM_STAT_ADD(self, stat_inserts, chunk_len);
+			if (pylsm_error(rc)) is_ok = 0;
+		}
+
+		for (Py_ssize_t i = 0; i < chunk_len; i++) Py_CLEAR(item_refs[i]);
+	}
+
+	// No per-key existence probes were made, so the cached counter is
+	// stale no matter how the load ended.
+	self->key_count_valid = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_WriteLock(self);
+	rc = lsm_config(self->lsm, LSM_CONFIG_AUTOFLUSH, &self->autoflush);
+	if (rc == LSM_OK) {
+		rc = lsm_config(self->lsm, LSM_CONFIG_AUTOWORK, &self->autowork);
 	}
+	LSM_WriteUnlock(self);
+	Py_END_ALLOW_THREADS
 
-	for (int i = 0; i < mapping_size && keys_objects[i] != NULL; i++) Py_DECREF(keys_objects[i]);
-	for (int i = 0; i < mapping_size && values_objects[i] != NULL; i++) Py_DECREF(values_objects[i]);
+	if (is_ok && pylsm_error(rc)) is_ok = 0;
 
 	PyMem_Free(key_sizes);
 	PyMem_Free(value_sizes);
 	PyMem_Free(keys);
 	PyMem_Free(values);
-	PyMem_Free(keys_objects);
-	PyMem_Free(values_objects);
+	PyMem_Free(item_refs);
+	PyMem_Free(packed_keys);
+	if (prev_key != NULL) PyMem_Free(prev_key);
 
-	Py_CLEAR(items);
 	Py_CLEAR(iterator);
 
 	if (is_ok) {
@@ -2123,7 +5194,52 @@ static PyObject* LSM_update(LSM* self, PyObject *args) {
 }
 
 
-static LSMTransaction* LSM_transaction(LSM* self) {
+static LSMTransaction* LSM_transaction(LSM* self, PyObject* args, PyObject* kwds) {
+	static char *kwlist[] = {"group", NULL};
+
+	int group = 0;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "|p", kwlist, &group)) return NULL;
+
+#ifdef LSM_MUTEX_PTHREADS
+	if (group) {
+		if (pylsm_ensure_writable(self)) return NULL;
+
+		int rc;
+
+		Py_BEGIN_ALLOW_THREADS
+		rc = pylsm_group_join(self);
+		Py_END_ALLOW_THREADS
+
+		if (rc == LSM_MISUSE) {
+			PyErr_SetString(
+				PyExc_RuntimeError,
+				"group transactions can not be mixed with an "
+				"explicitly opened transaction"
+			);
+			return NULL;
+		}
+		if (pylsm_error(rc)) return NULL;
+
+		LSMTransaction* tx = (LSMTransaction*) LSMTransaction_new(
+			&LSMTransactionType, self
+		);
+		if (tx == NULL) {
+			Py_BEGIN_ALLOW_THREADS
+			pylsm_group_leave(self, 1);
+			Py_END_ALLOW_THREADS
+			return NULL;
+		}
+
+		tx->group = 1;
+		return tx;
+	}
+#else
+	// Without pthreads there are no concurrent committers to
+	// coalesce; a group transaction degenerates to a plain one.
+	(void) group;
+#endif
+
 	LSM_begin(self);
 	if (PyErr_Occurred()) return NULL;
 
@@ -2134,6 +5250,82 @@ static LSMTransaction* LSM_transaction(LSM* self) {
 }
 
 
+static PyObject* LSM_write_batch(LSM* self) {
+	if (pylsm_ensure_writable(self)) return NULL;
+	return LSMWriteBatch_new(&LSMWriteBatchType, self);
+}
+
+
+// Delete a run of keys in one transaction and lock window. Unlike
+// __delitem__ it does not probe or report missing keys — deleting an
+// absent key is a no-op for the engine, and probing a million session
+// keys one by one is exactly what this call is meant to avoid.
+static PyObject* LSM_delete_many(LSM *self, PyObject *args) {
+	if (pylsm_ensure_writable(self)) return NULL;
+
+	PyObject *keys = NULL;
+
+	if (!PyArg_ParseTuple(args, "O", &keys)) return NULL;
+
+	PyObject *seq = PySequence_Fast(keys, "delete_many expects an iterable of keys");
+	if (seq == NULL) return NULL;
+
+	Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+	if (count == 0) {
+		Py_DECREF(seq);
+		Py_RETURN_NONE;
+	}
+
+	LSMBatchOp *ops = calloc(count, sizeof(LSMBatchOp));
+	if (ops == NULL) {
+		Py_DECREF(seq);
+		return PyErr_NoMemory();
+	}
+
+	int rc = LSM_OK;
+	Py_ssize_t prepared = 0;
+
+	for (prepared = 0; prepared < count; prepared++) {
+		PyObject *key = PySequence_Fast_GET_ITEM(seq, prepared);
+		const char *pKey = NULL;
+		Py_ssize_t nKey = 0;
+		char packed[PYLSM_INT_KEY_SIZE];
+
+		if (pylsm_key_check(self->binary, key, &pKey, &nKey, packed)) break;
+		if (nKey >= INT_MAX) {
+			PyErr_SetString(PyExc_OverflowError, "length of key is too large");
+			break;
+		}
+
+		if ((ops[prepared].pKey = calloc(nKey + 1, sizeof(char))) == NULL) {
+			PyErr_NoMemory();
+			break;
+		}
+		memcpy(ops[prepared].pKey, pKey, nKey);
+		ops[prepared].nKey = (int) nKey;
+	}
+
+	Py_DECREF(seq);
+
+	if (prepared == count) {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_WriteLock(self);
+		rc = pylsm_batch_apply(self, ops, count);
+		LSM_WriteUnlock(self);
+		Py_END_ALLOW_THREADS
+	}
+
+	pylsm_batch_free_ops(ops, prepared);
+	free(ops);
+
+	if (PyErr_Occurred()) return NULL;
+	if (pylsm_error(rc)) return NULL;
+
+	pylsm_worker_notify(self);
+	Py_RETURN_NONE;
+}
+
+
 static PyMemberDef LSM_members[] = {
 	{
 		"path",
@@ -2252,7 +5444,49 @@ static PyMemberDef LSM_members[] = {
 		T_INT,
 		offsetof(LSM, tx_level),
 		READONLY,
-		"Transaction nesting level"
+		"Transaction nesting level"
+	},
+	{
+		"cursor_pool_size",
+		T_INT,
+		offsetof(LSM, csr_pool_size),
+		READONLY,
+		"cursor_pool_size"
+	},
+	{
+		"iter_prefetch",
+		T_INT,
+		offsetof(LSM, iter_prefetch),
+		0,
+		"iter_prefetch"
+	},
+	{
+		"eager_work",
+		T_BOOL,
+		offsetof(LSM, eager_work),
+		READONLY,
+		"eager_work"
+	},
+	{
+		"logger_buffered",
+		T_BOOL,
+		offsetof(LSM, logger_buffered),
+		READONLY,
+		"logger_buffered"
+	},
+	{
+		"bloom_bits_per_key",
+		T_INT,
+		offsetof(LSM, bloom_bits_per_key),
+		READONLY,
+		"bloom_bits_per_key"
+	},
+	{
+		"compress_adaptive",
+		T_BOOL,
+		offsetof(LSM, compress_adaptive),
+		READONLY,
+		"compress_adaptive"
 	},
 	{NULL}  /* Sentinel */
 };
@@ -2299,6 +5533,21 @@ static PyMethodDef LSM_methods[] = {
 		(PyCFunction) LSM_checkpoint, METH_NOARGS,
 		"Explicit Database checkpointing"
 	},
+	{
+		"start_worker",
+		(PyCFunction) LSM_start_worker, METH_VARARGS | METH_KEYWORDS,
+		"Start background thread doing lsm_work and checkpoints"
+	},
+	{
+		"stop_worker",
+		(PyCFunction) LSM_stop_worker, METH_NOARGS,
+		"Stop the background worker thread"
+	},
+	{
+		"worker_stats",
+		(PyCFunction) LSM_worker_stats, METH_NOARGS,
+		"Background worker counters"
+	},
 	{
 		"cursor",
 		(PyCFunction) LSM_cursor, METH_VARARGS | METH_KEYWORDS,
@@ -2336,12 +5585,12 @@ static PyMethodDef LSM_methods[] = {
 	},
 	{
 		"transaction",
-		(PyCFunction) LSM_transaction, METH_NOARGS,
-		"Return transaction instance"
+		(PyCFunction) LSM_transaction, METH_VARARGS | METH_KEYWORDS,
+		"Return transaction instance; group=True joins a group commit"
 	},
 	{
 		"tx",
-		(PyCFunction) LSM_transaction, METH_NOARGS,
+		(PyCFunction) LSM_transaction, METH_VARARGS | METH_KEYWORDS,
 		"Alias of transaction method"
 	},
 	{
@@ -2365,6 +5614,81 @@ static PyMethodDef LSM_methods[] = {
 		"dict-like update method"
 
 	},
+	{
+		"bulk_load",
+		(PyCFunction) LSM_bulk_load, METH_VARARGS,
+		"Load pre-sorted key/value pairs at ingestion speed"
+	},
+	{
+		"backup",
+		(PyCFunction) LSM_backup, METH_VARARGS | METH_KEYWORDS,
+		"Stream a consistent copy of the database while writers continue"
+	},
+	{
+		"advise",
+		(PyCFunction) LSM_advise, METH_VARARGS | METH_KEYWORDS,
+		"Issue page-cache advice (posix_fadvise) for the database file"
+	},
+	{
+		"count",
+		(PyCFunction) LSM_count, METH_VARARGS | METH_KEYWORDS,
+		"Number of keys, cached after the first full scan"
+	},
+	{
+		"read_range",
+		(PyCFunction) LSM_read_range, METH_VARARGS | METH_KEYWORDS,
+		"Retrieve up to limit (key, value) pairs from a range in one call"
+	},
+	{
+		"count_range",
+		(PyCFunction) LSM_count_range, METH_VARARGS,
+		"Exact number of keys in a range without decoding entries"
+	},
+	{
+		"partitions",
+		(PyCFunction) LSM_partitions, METH_VARARGS | METH_KEYWORDS,
+		"Split the keyspace into n count-balanced inclusive ranges"
+	},
+	{
+		"estimate_size",
+		(PyCFunction) LSM_estimate_size, METH_VARARGS,
+		"Payload bytes stored in a range"
+	},
+	{
+		"getview",
+		(PyCFunction) LSM_getview, METH_VARARGS | METH_KEYWORDS,
+		"Zero-copy value lookup returning a memoryview"
+	},
+	{
+		"getmany",
+		(PyCFunction) LSM_getmany, METH_VARARGS | METH_KEYWORDS,
+		"Batch lookup of multiple keys over a single cursor"
+	},
+	{
+		"snapshot",
+		(PyCFunction) LSM_snapshot, METH_NOARGS,
+		"Additional read-only connection to the same database file"
+	},
+	{
+		"write_batch",
+		(PyCFunction) LSM_write_batch, METH_NOARGS,
+		"Buffered write batch applied in one transaction"
+	},
+	{
+		"delete_many",
+		(PyCFunction) LSM_delete_many, METH_VARARGS,
+		"Delete an iterable of keys in one transaction and lock window"
+	},
+	{
+		"drain_logs",
+		(PyCFunction) LSM_drain_logs, METH_NOARGS,
+		"Deliver buffered engine log messages to the logger"
+	},
+	{
+		"stats",
+		(PyCFunction) LSM_stats, METH_NOARGS,
+		"Wrapper-side operation and lock-wait counters"
+	},
 	{NULL}  /* Sentinel */
 };
 
@@ -2424,16 +5748,16 @@ static PyObject* LSMCursor_new(PyTypeObject *type, LSM *db, int seek_mode) {
 
 	int rc;
 
-	LSM_MutexLock(db);
-	rc = lsm_csr_open(self->db->lsm, &self->cursor);
-	LSM_MutexLeave(db);
+	LSM_ReadLock(db);
+	rc = pylsm_csr_open_shared(db, &self->cursor);
+	LSM_ReadUnlock(db);
 
 	if(pylsm_error(rc)) return NULL;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	rc = lsm_csr_first(self->cursor);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(rc)) return NULL;
@@ -2448,7 +5772,9 @@ static PyObject* LSMCursor_new(PyTypeObject *type, LSM *db, int seek_mode) {
 
 static void LSMCursor_dealloc(LSMCursor *self) {
 	if (self->state != PY_LSM_CLOSED && self->cursor != NULL) {
-		lsm_csr_close(self->cursor);
+		LSM_ReadLock(self->db);
+		pylsm_csr_close_shared(self->db, self->cursor);
+		LSM_ReadUnlock(self->db);
 		self->cursor = NULL;
 		self->state = PY_LSM_CLOSED;
 	}
@@ -2472,9 +5798,9 @@ static PyObject* LSMCursor_first(LSMCursor *self) {
 	int result;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	result = lsm_csr_first(self->cursor);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
@@ -2495,9 +5821,9 @@ static PyObject* LSMCursor_last(LSMCursor *self) {
 	int result;
 
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	result = lsm_csr_last(self->cursor);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(result)) return NULL;
@@ -2516,7 +5842,9 @@ static PyObject* LSMCursor_close(LSMCursor *self) {
 	}
 
 	int result;
-	result = lsm_csr_close(self->cursor);
+	LSM_ReadLock(self->db);
+	result = pylsm_csr_close_shared(self->db, self->cursor);
+	LSM_ReadUnlock(self->db);
 
 	if (pylsm_error(result)) return NULL;
 
@@ -2542,22 +5870,23 @@ static PyObject* LSMCursor_seek(LSMCursor *self, PyObject* args, PyObject* kwds)
 	PyObject* key = NULL;
 	const char* pKey = NULL;
 	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
 
 	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|i", kwlist, &key, &self->seek_mode)) return NULL;
 	if (pylsm_seek_mode_check(self->seek_mode)) return NULL;
 
 	int rc;
 
-	if (str_or_bytes_check(self->db->binary, key, &pKey, &nKey)) return NULL;
+	if (pylsm_key_check(self->db->binary, key, &pKey, &nKey, packed)) return NULL;
 
 	if (nKey >= INT_MAX) {
 		PyErr_SetString(PyExc_OverflowError, "length of key is too large");
 		return NULL;
 	}
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	rc = lsm_csr_seek(self->cursor, pKey, (int) nKey, self->seek_mode);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(rc)) return NULL;
@@ -2578,9 +5907,10 @@ static PyObject* LSMCursor_compare(LSMCursor *self, PyObject* args, PyObject* kw
 	PyObject * key = NULL;
 	const char* pKey = NULL;
 	Py_ssize_t nKey = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
 
 	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &key)) return NULL;
-	if (str_or_bytes_check(self->db->binary, key, &pKey, &nKey)) return NULL;
+	if (pylsm_key_check(self->db->binary, key, &pKey, &nKey, packed)) return NULL;
 
 	int cmp_result = 0;
 	int result;
@@ -2590,9 +5920,9 @@ static PyObject* LSMCursor_compare(LSMCursor *self, PyObject* args, PyObject* kw
 		return NULL;
 	}
 
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	result = lsm_csr_cmp(self->cursor, pKey, (int) nKey, &cmp_result);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 
 	if (self->seek_mode == LSM_SEEK_GE) cmp_result = -cmp_result;
 
@@ -2608,13 +5938,116 @@ static PyObject* LSMCursor_retrieve(LSMCursor *self) {
 	if (pylsm_ensure_csr_opened(self)) return NULL;
 	if(!lsm_csr_valid(self->cursor)) { Py_RETURN_NONE; }
 
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	PyObject* result = pylsm_cursor_items_fetch(self->cursor, self->db->binary);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	return result;
 }
 
 
+// Copy out up to n entries starting at the current position, walking
+// the cursor past them. Expects the shared lock held and the GIL
+// released. The caller owns the returned batch.
+static int pylsm_cursor_fetch_n(
+	LSMCursor *self, Py_ssize_t n,
+	LSMPrefetchItem **pItems, Py_ssize_t *pCount
+) {
+	LSMPrefetchItem *items;
+	LSMPrefetchItem *item;
+	Py_ssize_t count = 0;
+	const void *pKey;
+	const void *pVal;
+	int nKey, nVal;
+	int rc = LSM_OK;
+
+	*pItems = NULL;
+	*pCount = 0;
+
+	if (!lsm_csr_valid(self->cursor)) return LSM_OK;
+
+	items = calloc(n, sizeof(LSMPrefetchItem));
+	if (items == NULL) return LSM_NOMEM;
+
+	while (count < n && lsm_csr_valid(self->cursor)) {
+		item = &items[count];
+
+		if ((rc = lsm_csr_key(self->cursor, &pKey, &nKey))) break;
+		if ((rc = lsm_csr_value(self->cursor, &pVal, &nVal))) break;
+
+		if ((item->pKey = calloc(nKey + 1, sizeof(char))) == NULL) {
+			rc = LSM_NOMEM;
+			break;
+		}
+		memcpy(item->pKey, pKey, nKey);
+		item->nKey = nKey;
+
+		if ((item->pVal = calloc(nVal + 1, sizeof(char))) == NULL) {
+			free(item->pKey);
+			item->pKey = NULL;
+			rc = LSM_NOMEM;
+			break;
+		}
+		memcpy(item->pVal, pVal, nVal);
+		item->nVal = nVal;
+
+		count++;
+
+		// SEEK_EQ positions on one row; do not walk past it, the same
+		// way next() refuses to.
+		if (self->seek_mode == LSM_SEEK_EQ) break;
+		if ((rc = lsm_csr_next(self->cursor))) break;
+	}
+
+	if (rc != LSM_OK) {
+		pylsm_items_free(items, count);
+		return rc;
+	}
+
+	*pItems = items;
+	*pCount = count;
+	return LSM_OK;
+}
+
+
+// seek() plus fetch(n) replaces the retrieve()/next() ping-pong for
+// paginated reads: one lock and GIL window for the whole page instead
+// of one per row.
+static PyObject* LSMCursor_fetch(LSMCursor *self, PyObject* args, PyObject* kwds) {
+	if (self->state == PY_LSM_ITERATING) {
+		PyErr_SetString(PyExc_RuntimeError, "can not change cursor during iteration");
+		return NULL;
+	}
+	if (pylsm_ensure_csr_opened(self)) return NULL;
+
+	static char *kwlist[] = {"n", NULL};
+
+	Py_ssize_t n = 0;
+	LSMPrefetchItem *items = NULL;
+	Py_ssize_t count = 0;
+	int rc;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "n", kwlist, &n)) return NULL;
+
+	if (n < 1) {
+		PyErr_Format(
+			PyExc_ValueError, "n must be a positive integer. Not %zd", n
+		);
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	LSM_ReadLock(self->db);
+	rc = pylsm_cursor_fetch_n(self, n, &items, &count);
+	LSM_ReadUnlock(self->db);
+	Py_END_ALLOW_THREADS
+
+	if (pylsm_error(rc)) return NULL;
+
+	PYLSM_STAT_ADD(self->db, stat_gets, count);
+	return pylsm_items_to_list(items, count, self->db->binary);
+}
+
+
 static PyObject* LSMCursor_key(LSMCursor *self) {
 	if (self->state == PY_LSM_ITERATING) {
 		PyErr_SetString(PyExc_RuntimeError, "can not change cursor during iteration");
@@ -2623,9 +6056,9 @@ static PyObject* LSMCursor_key(LSMCursor *self) {
 	if (pylsm_ensure_csr_opened(self)) return NULL;
 	if(!lsm_csr_valid(self->cursor)) { Py_RETURN_NONE; }
 
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	PyObject* result = pylsm_cursor_key_fetch(self->cursor, self->db->binary);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 
 	return result;
 }
@@ -2639,9 +6072,9 @@ static PyObject* LSMCursor_value(LSMCursor *self) {
 	if (pylsm_ensure_csr_opened(self)) return NULL;
 	if(!lsm_csr_valid(self->cursor)) { Py_RETURN_NONE; }
 
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	PyObject* result = pylsm_cursor_value_fetch(self->cursor, self->db->binary);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 
 	return result;
 }
@@ -2658,9 +6091,9 @@ static PyObject* LSMCursor_next(LSMCursor *self) {
 
 	int err;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	err = lsm_csr_next(self->cursor);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(err)) return NULL;
@@ -2685,9 +6118,9 @@ static PyObject* LSMCursor_previous(LSMCursor *self) {
 
 	int err;
 	Py_BEGIN_ALLOW_THREADS
-	LSM_MutexLock(self->db);
+	LSM_ReadLock(self->db);
 	err = lsm_csr_prev(self->cursor);
-	LSM_MutexLeave(self->db);
+	LSM_ReadUnlock(self->db);
 	Py_END_ALLOW_THREADS
 
 	if (pylsm_error(err)) return NULL;
@@ -2779,6 +6212,11 @@ static PyMethodDef LSMCursor_methods[] = {
 		(PyCFunction) LSMCursor_retrieve, METH_NOARGS,
 		"Retrieve key and value"
 	},
+	{
+		"fetch",
+		(PyCFunction) LSMCursor_fetch, METH_VARARGS | METH_KEYWORDS,
+		"Retrieve up to n (key, value) pairs from the current position"
+	},
 	{
 		"key",
 		(PyCFunction) LSMCursor_key, METH_NOARGS,
@@ -2827,8 +6265,10 @@ static PyObject* LSMTransaction_new(PyTypeObject *type, LSM* db) {
 	LSMTransaction *self;
 
 	self = (LSMTransaction *) type->tp_alloc(type, 0);
+	if (self == NULL) return NULL;
 	self->state = PY_LSM_INITIALIZED;
 	self->db = db;
+	self->group = 0;
 	self->tx_level = self->db->tx_level;
 
 	Py_INCREF(self->db);
@@ -2843,6 +6283,14 @@ static void LSMTransaction_dealloc(LSMTransaction *self) {
 
 	Py_DECREF(self->db);
 	if (self->state != PY_LSM_CLOSED && self->db->state != PY_LSM_CLOSED) {
+#ifdef LSM_MUTEX_PTHREADS
+		if (self->group) {
+			Py_BEGIN_ALLOW_THREADS
+			pylsm_group_leave(self->db, 1);
+			Py_END_ALLOW_THREADS
+			return;
+		}
+#endif
 		LSM_rollback_inner(self->db, self->tx_level);
 	}
 }
@@ -2868,6 +6316,16 @@ static PyObject* LSMTransaction_ctx_exit(
 
 	self->state = PY_LSM_CLOSED;
 
+#ifdef LSM_MUTEX_PTHREADS
+	if (self->group) {
+		if (pylsm_ensure_writable(self->db)) return NULL;
+		if (pylsm_group_leave_checked(self->db, exc_type != Py_None)) {
+			return NULL;
+		}
+		Py_RETURN_NONE;
+	}
+#endif
+
 	if (exc_type == Py_None) {
 		LSM_commit_inner(self->db, self->tx_level - 1);
 	} else {
@@ -2881,6 +6339,23 @@ static PyObject* LSMTransaction_ctx_exit(
 
 
 static PyObject* LSMTransaction_commit(LSMTransaction *self) {
+#ifdef LSM_MUTEX_PTHREADS
+	// A group commit rejoins the next batch so the object stays
+	// usable, mirroring the re-begin below.
+	if (self->group) {
+		if (pylsm_ensure_writable(self->db)) return NULL;
+		if (pylsm_group_leave_checked(self->db, 0)) return NULL;
+
+		int rc;
+		Py_BEGIN_ALLOW_THREADS
+		rc = pylsm_group_join(self->db);
+		Py_END_ALLOW_THREADS
+
+		if (pylsm_error(rc)) return NULL;
+		Py_RETURN_TRUE;
+	}
+#endif
+
 	PyObject * result = LSM_commit_inner(self->db, self->tx_level -1);
 	if (PyErr_Occurred()) return NULL;
 	if (pylsm_error(lsm_begin(self->db->lsm, self->tx_level))) return NULL;
@@ -2889,6 +6364,21 @@ static PyObject* LSMTransaction_commit(LSMTransaction *self) {
 
 
 static PyObject* LSMTransaction_rollback(LSMTransaction *self) {
+#ifdef LSM_MUTEX_PTHREADS
+	if (self->group) {
+		if (pylsm_ensure_writable(self->db)) return NULL;
+		if (pylsm_group_leave_checked(self->db, 1)) return NULL;
+
+		int rc;
+		Py_BEGIN_ALLOW_THREADS
+		rc = pylsm_group_join(self->db);
+		Py_END_ALLOW_THREADS
+
+		if (pylsm_error(rc)) return NULL;
+		Py_RETURN_TRUE;
+	}
+#endif
+
 	return LSM_rollback_inner(self->db, self->tx_level);
 }
 
@@ -2902,6 +6392,13 @@ static PyMemberDef LSMTransaction_members[] = {
 		READONLY,
 		"Transaction level"
 	},
+	{
+		"group",
+		T_BOOL,
+		offsetof(LSMTransaction, group),
+		READONLY,
+		"Whether commits coalesce into a shared group commit"
+	},
 	{NULL}  /* Sentinel */
 };
 
@@ -2945,6 +6442,243 @@ static PyTypeObject LSMTransactionType = {
 };
 
 
+static PyObject* LSMWriteBatch_new(PyTypeObject *type, LSM* db) {
+	LSMWriteBatch *self;
+
+	self = (LSMWriteBatch *) type->tp_alloc(type, 0);
+	if (self == NULL) return NULL;
+
+	self->state = PY_LSM_INITIALIZED;
+	self->db = db;
+	self->ops = NULL;
+	self->ops_used = 0;
+	self->ops_cap = 0;
+
+	Py_INCREF(self->db);
+
+	return (PyObject *) self;
+}
+
+
+static void LSMWriteBatch_drop(LSMWriteBatch *self) {
+	pylsm_batch_free_ops(self->ops, self->ops_used);
+	self->ops_used = 0;
+}
+
+
+static void LSMWriteBatch_dealloc(LSMWriteBatch *self) {
+	if (self->weakrefs != NULL) PyObject_ClearWeakRefs((PyObject *) self);
+	if (self->db == NULL) return;
+
+	LSMWriteBatch_drop(self);
+	if (self->ops != NULL) free(self->ops);
+	self->ops = NULL;
+
+	Py_DECREF(self->db);
+	self->db = NULL;
+}
+
+
+// Copy the key (and value, for puts) into the op buffer. Buffered data
+// is owned by the batch, so the caller's objects may die before apply.
+static int pylsm_batch_append(
+	LSMWriteBatch *self, PyObject *key, PyObject *value
+) {
+	const char *pKey = NULL;
+	Py_ssize_t nKey = 0;
+	const char *pVal = NULL;
+	Py_ssize_t nVal = 0;
+	char packed[PYLSM_INT_KEY_SIZE];
+	LSMBatchOp *op;
+
+	if (pylsm_key_check(self->db->binary, key, &pKey, &nKey, packed)) return -1;
+	if (value != NULL) {
+		if (str_or_bytes_check(self->db->binary, value, &pVal, &nVal)) return -1;
+	}
+
+	if (nKey >= INT_MAX || nVal >= INT_MAX) {
+		PyErr_SetString(PyExc_OverflowError, "length of key or value is too large");
+		return -1;
+	}
+
+	if (self->ops_used >= self->ops_cap) {
+		Py_ssize_t new_cap = (self->ops_cap > 0) ? self->ops_cap * 2 : 64;
+		LSMBatchOp *ops = realloc(self->ops, new_cap * sizeof(LSMBatchOp));
+		if (ops == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		self->ops = ops;
+		self->ops_cap = new_cap;
+	}
+
+	op = &self->ops[self->ops_used];
+	memset(op, 0, sizeof(LSMBatchOp));
+
+	if ((op->pKey = calloc(nKey + 1, sizeof(char))) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	memcpy(op->pKey, pKey, nKey);
+	op->nKey = (int) nKey;
+
+	if (value != NULL) {
+		if ((op->pVal = calloc(nVal + 1, sizeof(char))) == NULL) {
+			free(op->pKey);
+			PyErr_NoMemory();
+			return -1;
+		}
+		memcpy(op->pVal, pVal, nVal);
+		op->nVal = (int) nVal;
+	}
+
+	self->ops_used++;
+	return 0;
+}
+
+
+static PyObject* LSMWriteBatch_put(
+	LSMWriteBatch *self, PyObject *args, PyObject *kwds
+) {
+	if (pylsm_ensure_writable(self->db)) return NULL;
+
+	static char *kwlist[] = {"key", "value", NULL};
+
+	PyObject *key = NULL;
+	PyObject *value = NULL;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO", kwlist, &key, &value)) return NULL;
+	if (pylsm_batch_append(self, key, value)) return NULL;
+
+	Py_RETURN_NONE;
+}
+
+
+static PyObject* LSMWriteBatch_delete(
+	LSMWriteBatch *self, PyObject *args, PyObject *kwds
+) {
+	if (pylsm_ensure_writable(self->db)) return NULL;
+
+	static char *kwlist[] = {"key", NULL};
+
+	PyObject *key = NULL;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", kwlist, &key)) return NULL;
+	if (pylsm_batch_append(self, key, NULL)) return NULL;
+
+	Py_RETURN_NONE;
+}
+
+
+static PyObject* LSMWriteBatch_clear(LSMWriteBatch *self) {
+	LSMWriteBatch_drop(self);
+	Py_RETURN_NONE;
+}
+
+
+static PyObject* LSMWriteBatch_apply(LSMWriteBatch *self) {
+	if (pylsm_ensure_writable(self->db)) return NULL;
+
+	int rc = LSM_OK;
+
+	if (self->ops_used > 0) {
+		Py_BEGIN_ALLOW_THREADS
+		LSM_WriteLock(self->db);
+		rc = pylsm_batch_apply(self->db, self->ops, self->ops_used);
+		LSM_WriteUnlock(self->db);
+		Py_END_ALLOW_THREADS
+	}
+
+	LSMWriteBatch_drop(self);
+
+	if (pylsm_error(rc)) return NULL;
+
+	pylsm_worker_notify(self->db);
+	Py_RETURN_NONE;
+}
+
+
+static Py_ssize_t LSMWriteBatch_length(LSMWriteBatch *self) {
+	return self->ops_used;
+}
+
+
+static PyObject* LSMWriteBatch_ctx_enter(LSMWriteBatch *self) {
+	if (pylsm_ensure_writable(self->db)) return NULL;
+	return (PyObject*) self;
+}
+
+
+static PyObject* LSMWriteBatch_ctx_exit(
+	LSMWriteBatch *self, PyObject *const *args
+) {
+	PyObject *exc_type, *exc_value, *exc_tb;
+	if (!PyArg_ParseTuple((PyObject*) args, "OOO", &exc_type, &exc_value, &exc_tb)) return NULL;
+
+	if (exc_type == Py_None) {
+		if (LSMWriteBatch_apply(self) == NULL) return NULL;
+	} else {
+		LSMWriteBatch_drop(self);
+	}
+
+	Py_RETURN_NONE;
+}
+
+
+static PySequenceMethods LSMWriteBatchSequence = {
+	.sq_length = (lenfunc) LSMWriteBatch_length
+};
+
+
+static PyMethodDef LSMWriteBatch_methods[] = {
+	{
+		"__enter__",
+		(PyCFunction) LSMWriteBatch_ctx_enter, METH_NOARGS,
+		"Enter context"
+	},
+	{
+		"__exit__",
+		(PyCFunction) LSMWriteBatch_ctx_exit, METH_VARARGS,
+		"Exit context applying buffered operations unless an exception is set"
+	},
+	{
+		"put",
+		(PyCFunction) LSMWriteBatch_put, METH_VARARGS | METH_KEYWORDS,
+		"Buffer an insert"
+	},
+	{
+		"delete",
+		(PyCFunction) LSMWriteBatch_delete, METH_VARARGS | METH_KEYWORDS,
+		"Buffer a delete"
+	},
+	{
+		"clear",
+		(PyCFunction) LSMWriteBatch_clear, METH_NOARGS,
+		"Discard buffered operations"
+	},
+	{
+		"apply",
+		(PyCFunction) LSMWriteBatch_apply, METH_NOARGS,
+		"Apply buffered operations in one transaction and lock window"
+	},
+	{NULL}  /* Sentinel */
+};
+
+
+static PyTypeObject LSMWriteBatchType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	.tp_name = "WriteBatch",
+	.tp_doc = "Buffered inserts and deletes applied in one transaction",
+	.tp_basicsize = sizeof(LSMWriteBatch),
+	.tp_itemsize = 0,
+	.tp_flags = Py_TPFLAGS_DEFAULT,
+	.tp_dealloc = (destructor) LSMWriteBatch_dealloc,
+	.tp_methods = LSMWriteBatch_methods,
+	.tp_as_sequence = &LSMWriteBatchSequence,
+	.tp_weaklistoffset = offsetof(LSMWriteBatch, weakrefs)
+};
+
+
 static PyModuleDef lsm_module = {
 	PyModuleDef_HEAD_INIT,
 	.m_name = "lsm",
@@ -2999,6 +6733,18 @@ PyMODINIT_FUNC PyInit_lsm(void) {
 	if (PyType_Ready(&LSMSliceType) < 0) return NULL;
 	Py_INCREF(&LSMSliceType);
 
+	if (PyType_Ready(&LSMValueViewType) < 0) return NULL;
+	Py_INCREF(&LSMValueViewType);
+
+	if (PyType_Ready(&LSMWriteBatchType) < 0) return NULL;
+	Py_INCREF(&LSMWriteBatchType);
+
+	if (PyModule_AddObject(m, "WriteBatch", (PyObject *) &LSMWriteBatchType) < 0) {
+		Py_XDECREF(&LSMWriteBatchType);
+		Py_XDECREF(m);
+		return NULL;
+	}
+
 	PyModule_AddIntConstant(m, "SAFETY_OFF", LSM_SAFETY_OFF);
 	PyModule_AddIntConstant(m, "SAFETY_NORMAL", LSM_SAFETY_NORMAL);
 	PyModule_AddIntConstant(m, "SAFETY_FULL", LSM_SAFETY_FULL);
@@ -3012,5 +6758,12 @@ PyMODINIT_FUNC PyInit_lsm(void) {
 	PyModule_AddIntConstant(m, "SEEK_GE", LSM_SEEK_GE);
 	PyModule_AddIntConstant(m, "SEEK_LEFAST", LSM_SEEK_LEFAST);
 
+	// Free-threaded builds import the module with the GIL re-enabled:
+	// shared counters are atomic and cross-thread state transitions go
+	// through PYLSM_FIELD_SET/GET, but Py_MOD_GIL_NOT_USED stays
+	// undeclared until every path into the engine and the
+	// view/iterator object lifetimes have been audited for life
+	// without the GIL narrowing the races.
+
 	return m;
 }
@@ -0,0 +1,90 @@
+import asyncio
+
+import pytest
+
+from lsm_aio import AsyncLSM
+
+
+def test_async_basic(subtests, tmp_path):
+    async def main():
+        async with AsyncLSM(str(tmp_path / "db.lsm"), binary=False) as db:
+            with subtests.test("set and get"):
+                await db.aset("foo", "bar")
+                assert await db.aget("foo") == "bar"
+
+            with subtests.test("missing key"):
+                with pytest.raises(KeyError):
+                    await db.aget("missing")
+                assert await db.aget("missing", default="d") == "d"
+
+            with subtests.test("delete"):
+                await db.adelete("foo")
+                with pytest.raises(KeyError):
+                    await db.aget("foo")
+                # absent keys are ignored
+                await db.adelete("foo")
+
+            with subtests.test("update and getmany"):
+                await db.aupdate({"k{}".format(i): str(i) for i in range(100)})
+                result = await db.agetmany(["k1", "k2", "nope"])
+                assert result == {"k1": "1", "k2": "2", "nope": None}
+
+            with subtests.test("maintenance calls"):
+                await db.aflush()
+                await db.awork(complete=True)
+
+    asyncio.run(main())
+
+
+def test_async_batching(subtests, tmp_path):
+    async def main():
+        async with AsyncLSM(str(tmp_path / "db.lsm"), binary=False) as db:
+            with subtests.test("concurrent writes then reads"):
+                await asyncio.gather(*(
+                    db.aset("k{}".format(i), str(i)) for i in range(1000)
+                ))
+                values = await asyncio.gather(*(
+                    db.aget("k{}".format(i)) for i in range(1000)
+                ))
+                assert values == [str(i) for i in range(1000)]
+
+            with subtests.test("interleaved kinds keep order"):
+                await db.aset("x", "1")
+                results = await asyncio.gather(
+                    db.aset("x", "2"),
+                    db.aget("x"),
+                    db.adelete("x"),
+                    db.aget("x", default=None),
+                )
+                assert results[1] == "2"
+                assert results[3] is None
+
+    asyncio.run(main())
+
+
+def test_async_lifecycle(subtests, tmp_path):
+    async def main():
+        db = AsyncLSM(str(tmp_path / "db.lsm"), binary=False)
+
+        with subtests.test("submit before open"):
+            with pytest.raises(RuntimeError):
+                await db.aget("foo")
+
+        with subtests.test("open, use, close"):
+            await db.open()
+            await db.aset("foo", "bar")
+            await db.close()
+
+        with subtests.test("double close is a no-op"):
+            assert await db.close() is False
+
+        with subtests.test("submit after close fails fast"):
+            with pytest.raises(RuntimeError):
+                await db.aget("foo")
+
+        with subtests.test("data persisted"):
+            async with AsyncLSM(str(tmp_path / "db.lsm"),
+                                binary=False) as again:
+                assert await again.aget("foo") == "bar"
+
+    asyncio.run(main())
@@ -35,4 +35,46 @@ def test_argument_checks(subtests, tmp_path):
     with subtests.test("logger=1"), pytest.raises(ValueError):
         LSM(str(tmp_path / "test.lsm"), logger=1)
 
+    with subtests.test("cursor_pool_size=-1"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), cursor_pool_size=-1)
+
+    with subtests.test("cursor_pool_size=1025"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), cursor_pool_size=1025)
+
+    with subtests.test("iter_prefetch=0"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), iter_prefetch=0)
+
+    with subtests.test("iter_prefetch=65537"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), iter_prefetch=65537)
+
+    with subtests.test("bloom_bits_per_key=-1"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), bloom_bits_per_key=-1)
+
+    with subtests.test("bloom_bits_per_key=65"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), bloom_bits_per_key=65)
+
+    with subtests.test("compress_dict without zstd"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), compress="lz4", compress_dict=b"x")
+
+    with subtests.test("compress_dict=str"), pytest.raises(ValueError):
+        LSM(str(tmp_path / "test.lsm"), compress="zstd", compress_dict="x")
+
+    with subtests.test("compress_dict round trip"):
+        sample = b"some common prefix " * 16
+        with LSM(str(tmp_path / "test-dict.lsm"), compress="zstd",
+                 compress_dict=sample) as db:
+            for i in range(100):
+                db[b"k%d" % i] = b"some common prefix %d" % i
+
+        with LSM(str(tmp_path / "test-dict.lsm"), compress="zstd",
+                 compress_dict=sample, readonly=True) as db:
+            assert db[b"k42"] == b"some common prefix 42"
+
+    with subtests.test("cursor_pool_size=0 disables the pool"):
+        with LSM(str(tmp_path / "test-nopool.lsm"),
+                 cursor_pool_size=0, binary=False) as db:
+            db["foo"] = "bar"
+            assert db["foo"] == "bar"
+            assert db.cursor_pool_size == 0
+
 
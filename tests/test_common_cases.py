@@ -84,6 +84,14 @@ def test_insert_select(subtests, db):
             ('k{}'.format(i), str(i)) for i in range(99, 89, -1)
         )
 
+    with subtests.test("slice select ['k10':'k19':3]"):
+        assert list(db['k10':'k19':3]) == list(
+            ('k{}'.format(i), str(i)) for i in range(10, 20, 3)
+        )
+
+    with subtests.test("slice select with step past the stop key"):
+        assert list(db['k90':'k99':1000]) == [('k90', '90')]
+
     with subtests.test("select ['k90xx', SEEK_LE]"):
         assert db['k90xx', SEEK_LE] == '90'
 
@@ -106,6 +114,191 @@ def test_insert_select(subtests, db):
         assert len(db) == 100
         assert db['k19'] == '19'
 
+    with subtests.test("update from iterable of pairs"):
+        db.update(("g{}".format(i), str(i)) for i in range(2000))
+        assert db['g1999'] == '1999'
+
+    with subtests.test("update rejects non-pair items"):
+        with pytest.raises(ValueError):
+            db.update([("a", "b", "c")])
+
+
+def test_write_batch(subtests, db):
+    with subtests.test("puts and deletes apply atomically"):
+        db["keep"] = "old"
+        with db.write_batch() as batch:
+            for i in range(100):
+                batch.put("b{}".format(i), str(i))
+            batch.delete("keep")
+            assert len(batch) == 101
+            # nothing visible until the context exits
+            assert "b0" not in db
+        assert db["b99"] == "99"
+        assert "keep" not in db
+
+    with subtests.test("exception discards the batch"):
+        with pytest.raises(ZeroDivisionError):
+            with db.write_batch() as batch:
+                batch.put("never", "written")
+                1 / 0
+        assert "never" not in db
+
+    with subtests.test("explicit apply and clear"):
+        batch = db.write_batch()
+        batch.put("x", "1")
+        batch.clear()
+        batch.put("y", "2")
+        batch.apply()
+        assert "x" not in db
+        assert db["y"] == "2"
+        assert len(batch) == 0
+
+    with subtests.test("wrong key type"):
+        with pytest.raises(ValueError):
+            db.write_batch().put(b"binary", b"nope")
+
+
+def test_bulk_load(subtests, db):
+    with subtests.test("sorted load"):
+        db.bulk_load(("k{:05d}".format(i), str(i)) for i in range(10000))
+        assert len(db) == 10000
+        assert db["k09999"] == "9999"
+
+    with subtests.test("settings are restored"):
+        assert db.autowork
+
+    with subtests.test("unsorted input is rejected"):
+        with pytest.raises(ValueError):
+            db.bulk_load([("b", "1"), ("a", "2")])
+
+    with subtests.test("duplicates are allowed, last one wins"):
+        db.bulk_load([("dup", "1"), ("dup", "2")])
+        assert db["dup"] == "2"
+
+    with subtests.test("rejected inside a transaction"):
+        with db.transaction():
+            with pytest.raises(RuntimeError):
+                db.bulk_load([("x", "1")])
+
+    with subtests.test("non-pair items"):
+        with pytest.raises(ValueError):
+            db.bulk_load([("a", "b", "c")])
+
+
+def test_delete_many(subtests, db):
+    for i in range(1000):
+        db["k{}".format(i)] = str(i)
+
+    with subtests.test("bulk delete"):
+        db.delete_many(["k{}".format(i) for i in range(500)])
+        assert len(db) == 500
+        assert "k0" not in db
+        assert db["k999"] == "999"
+
+    with subtests.test("missing keys are ignored"):
+        db.delete_many(["k0", "k999"])
+        assert "k999" not in db
+
+    with subtests.test("empty iterable"):
+        db.delete_many([])
+
+    with subtests.test("wrong key type"):
+        with pytest.raises(ValueError):
+            db.delete_many([b"k1"])
+
+
+def test_bloom_filter(subtests, tmp_path):
+    with LSM(tmp_path / "db.lsm", binary=False, bloom_bits_per_key=10) as db:
+        for i in range(1000):
+            db["k{}".format(i)] = str(i)
+
+        with subtests.test("hits and misses"):
+            assert db["k10"] == "10"
+            assert "k10" in db
+            assert "missing" not in db
+            with pytest.raises(KeyError):
+                _ = db["missing"]
+
+        with subtests.test("deleted keys stay absent"):
+            del db["k10"]
+            assert "k10" not in db
+
+        with subtests.test("getmany skips absent keys"):
+            assert db.getmany(["k1", "nope"]) == {"k1": "1", "nope": None}
+
+    with subtests.test("filter is rebuilt on open"):
+        with LSM(tmp_path / "db.lsm", binary=False,
+                 bloom_bits_per_key=10) as db:
+            assert db.bloom_bits_per_key == 10
+            assert db["k999"] == "999"
+            assert "missing" not in db
+
+
+@pytest.mark.parametrize("comp", ["lz4", "zstd"])
+def test_adaptive_compression(comp, subtests, tmp_path):
+    import os
+
+    path = tmp_path / ("db.lsm." + comp)
+    compressible = "x" * 4096
+    incompressible = os.urandom(4096)
+
+    with LSM(path, compress=comp, compress_adaptive=True) as db:
+        assert db.compress_adaptive
+        assert db.compress == comp
+
+        for i in range(500):
+            db["text_{}".format(i).encode()] = compressible.encode()
+            db["blob_{}".format(i).encode()] = incompressible
+
+        with subtests.test("data round-trips"):
+            assert db[b"text_499"] == compressible.encode()
+            assert db[b"blob_499"] == incompressible
+
+        with subtests.test("page counters are populated"):
+            db.work(complete=True)
+            stats = db.stats()
+            assert stats["pages_compressed"] > 0
+
+    with subtests.test("reopen reads the same file"):
+        with LSM(path, compress=comp, compress_adaptive=True,
+                 readonly=True) as db:
+            assert db[b"text_0"] == compressible.encode()
+            assert db[b"blob_0"] == incompressible
+            assert sum(1 for _ in db.keys()) == 1000
+
+    with subtests.test("adaptive requires a compressor"):
+        with pytest.raises(ValueError):
+            LSM(tmp_path / "nope.lsm", compress_adaptive=True)
+        with pytest.raises(ValueError):
+            LSM(tmp_path / "nope.lsm", compress="none",
+                compress_adaptive=True)
+
+
+def test_iter_prefetch(subtests, tmp_path):
+    with LSM(tmp_path / "db.lsm", binary=False, iter_prefetch=7) as db:
+        for i in range(100):
+            db["k{:03d}".format(i)] = str(i)
+
+        expected = ["k{:03d}".format(i) for i in range(100)]
+
+        with subtests.test("batches smaller than the key count"):
+            assert list(db.keys()) == expected
+            assert list(db.values()) == [str(i) for i in range(100)]
+            assert [k for k, _ in db.items()] == expected
+
+        with subtests.test("prefetch larger than the key count"):
+            db.iter_prefetch = 1024
+            assert list(db.keys()) == expected
+
+        with subtests.test("iterator survives interleaved writes"):
+            db.iter_prefetch = 8
+            seen = []
+            for idx, key in enumerate(db.keys()):
+                if idx == 50:
+                    db["zzz"] = "tail"
+                seen.append(key)
+            assert seen[:100] == expected
+
 
 @pytest.mark.parametrize("comp", comp_algo)
 def test_info(comp, tmp_path):
@@ -129,6 +322,46 @@ def test_info(comp, tmp_path):
         assert 'tree_size' not in info
 
 
+@pytest.mark.parametrize("comp", comp_algo)
+def test_info_structure(comp, tmp_path):
+    with LSM(tmp_path / ("test.lsm." + comp), compress=comp,
+             binary=False) as db:
+        for i in map(str, range(10000)):
+            db[i] = i
+
+        info = db.info()
+        assert isinstance(info.get('db_structure'), str)
+        assert isinstance(info.get('log_structure'), str)
+        assert isinstance(info.get('freelist'), str)
+        assert 'compression_id' in info
+
+
+def test_stats(subtests, tmp_path):
+    with LSM(tmp_path / "test.lsm", binary=False) as db:
+        with subtests.test("counters start at zero"):
+            stats = db.stats()
+            assert stats["inserts"] == 0
+            assert stats["deletes"] == 0
+
+        with subtests.test("writes and reads are counted"):
+            for i in range(10):
+                db[str(i)] = str(i)
+
+            assert db.stats()["inserts"] == 10
+
+            _ = db["5"]
+            assert "5" in db
+            assert db.stats()["gets"] >= 2
+
+            del db["5"]
+            assert db.stats()["deletes"] == 1
+
+        with subtests.test("cursor opens and lock waits are reported"):
+            stats = db.stats()
+            assert stats["cursors_opened"] >= 1
+            assert stats["lock_wait_ns"] >= 0
+
+
 @pytest.mark.parametrize("comp", comp_algo)
 def test_len(comp, tmp_path):
     with LSM(tmp_path / ("test.lsm." + comp), compress=comp,
@@ -140,3 +373,301 @@ def test_len(comp, tmp_path):
         assert len(db.keys()) == 10000
         assert len(db.values()) == 10000
         assert len(db.items()) == 10000
+
+
+@pytest.mark.parametrize("comp", comp_algo)
+def test_count(comp, subtests, tmp_path):
+    with LSM(tmp_path / ("test.lsm." + comp), compress=comp,
+             binary=False) as db:
+        for i in map(str, range(1000)):
+            db[i] = i
+
+        with subtests.test("count matches len"):
+            assert db.count() == 1000
+            assert db.count(exact=True) == 1000
+            assert len(db) == 1000
+
+        with subtests.test("insert and delete keep the counter in sync"):
+            db["another"] = "one"
+            assert db.count() == 1001
+
+            # overwriting must not bump the counter
+            db["another"] = "two"
+            assert db.count() == 1001
+
+            del db["another"]
+            assert db.count() == 1000
+
+            # deleting a missing key must not decrement
+            db.delete("missing")
+            assert db.count() == 1000
+
+        with subtests.test("delete_range invalidates the cache"):
+            del db["1":"2"]
+            assert db.count() == db.count(exact=True)
+
+
+def test_count_range(subtests, db):
+    for i in range(100):
+        db["k{:03d}".format(i)] = str(i)
+
+    with subtests.test("inclusive bounds match slices"):
+        assert db.count_range("k010", "k019") == 10
+        assert db.count_range("k010", "k019") == len(
+            list(db["k010":"k019"])
+        )
+
+    with subtests.test("empty range"):
+        assert db.count_range("x", "z") == 0
+        assert db.count_range("k019", "k010") == 0
+
+    with subtests.test("size accounts for keys and values"):
+        size = db.estimate_size("k010", "k019")
+        expected = sum(
+            len("k{:03d}".format(i)) + len(str(i)) for i in range(10, 20)
+        )
+        assert size == expected
+        assert db.estimate_size("x", "z") == 0
+
+    with subtests.test("wrong key type"):
+        with pytest.raises(ValueError):
+            db.count_range(b"k010", b"k019")
+
+
+def test_read_range(subtests, db):
+    for i in range(100):
+        db["k{:03d}".format(i)] = str(i)
+
+    with subtests.test("inclusive bounds match slices"):
+        assert db.read_range("k010", "k019") == list(db["k010":"k019"])
+
+    with subtests.test("limit truncates the page"):
+        page = db.read_range("k010", "k099", limit=10)
+        assert page == [("k{:03d}".format(i), str(i)) for i in range(10, 20)]
+        assert db.read_range("k010", "k099", limit=0) == []
+
+    with subtests.test("empty range"):
+        assert db.read_range("x", "z") == []
+        assert db.read_range("k019", "k010") == []
+
+    with subtests.test("wrong key type"):
+        with pytest.raises(ValueError):
+            db.read_range(b"k010", b"k019")
+
+
+def test_cursor_fetch(subtests, db):
+    for i in range(100):
+        db["k{:03d}".format(i)] = str(i)
+
+    with subtests.test("seek plus fetch paginates"):
+        with db.cursor(SEEK_GE) as cursor:
+            assert cursor.seek("k010", SEEK_GE)
+            page = cursor.fetch(10)
+            assert page == [
+                ("k{:03d}".format(i), str(i)) for i in range(10, 20)
+            ]
+
+            # the cursor advanced past the page, so the next call
+            # continues where the previous one stopped
+            assert cursor.fetch(5) == [
+                ("k{:03d}".format(i), str(i)) for i in range(20, 25)
+            ]
+
+    with subtests.test("fetch clips at the end of the database"):
+        with db.cursor(SEEK_GE) as cursor:
+            assert cursor.seek("k095", SEEK_GE)
+            assert len(cursor.fetch(100)) == 5
+            assert cursor.fetch(10) == []
+
+    with subtests.test("SEEK_EQ yields at most the current row"):
+        with db.cursor(SEEK_EQ) as cursor:
+            assert cursor.seek("k050", SEEK_EQ)
+            assert cursor.fetch(10) == [("k050", "50")]
+
+    with subtests.test("n must be positive"):
+        with db.cursor(SEEK_GE) as cursor:
+            with pytest.raises(ValueError):
+                cursor.fetch(0)
+
+
+def test_getview(subtests, db_binary: LSM):
+    payload = b"\x00\x01" * 65536
+    db_binary[b"blob"] = payload
+
+    with subtests.test("zero-copy read"):
+        view = db_binary.getview(b"blob")
+        assert isinstance(view, memoryview)
+        assert view.readonly
+        assert len(view) == len(payload)
+        assert bytes(view) == payload
+        view.release()
+
+    with subtests.test("missing key"):
+        with pytest.raises(KeyError):
+            db_binary.getview(b"missing")
+
+
+def test_getmany(subtests, db):
+    for i in range(100):
+        db["k{}".format(i)] = str(i)
+
+    with subtests.test("all keys present"):
+        result = db.getmany(["k1", "k2", "k3"])
+        assert result == {"k1": "1", "k2": "2", "k3": "3"}
+
+    with subtests.test("missing keys get the default"):
+        result = db.getmany(["k1", "nope"])
+        assert result == {"k1": "1", "nope": None}
+
+        result = db.getmany(["k1", "nope"], default="")
+        assert result == {"k1": "1", "nope": ""}
+
+    with subtests.test("empty sequence"):
+        assert db.getmany([]) == {}
+
+    with subtests.test("wrong key type"):
+        with pytest.raises(ValueError):
+            db.getmany([b"k1"])
+
+
+def test_partitions(subtests, db):
+    for i in range(1000):
+        db["k{:04d}".format(i)] = str(i)
+
+    with subtests.test("ranges are balanced and cover every key"):
+        ranges = db.partitions(4)
+        assert len(ranges) == 4
+        assert ranges[0][0] == "k0000"
+        assert ranges[-1][1] == "k0999"
+
+        counts = [db.count_range(start, stop) for start, stop in ranges]
+        assert sum(counts) == 1000
+        assert max(counts) - min(counts) <= 1
+
+    with subtests.test("ranges are contiguous and disjoint"):
+        ranges = db.partitions(7)
+        for (_, stop), (start, _) in zip(ranges, ranges[1:]):
+            assert stop < start
+
+    with subtests.test("n is clamped to the key count"):
+        assert len(db.partitions(10000)) == 1000
+
+    with subtests.test("single partition is the whole keyspace"):
+        assert db.partitions(1) == [("k0000", "k0999")]
+
+    with subtests.test("n must be positive"):
+        with pytest.raises(ValueError):
+            db.partitions(0)
+
+
+def test_partitions_empty(tmp_path):
+    with LSM(tmp_path / "empty.lsm") as db:
+        assert db.partitions(8) == []
+
+
+def test_read_buffer_reuse(subtests, db_binary: LSM):
+    sizes = [10, 100, 1000, 10000, 100000]
+    for i, size in enumerate(sizes):
+        db_binary[b"k%d" % i] = bytes([i]) * size
+
+    with subtests.test("repeated point reads across size classes"):
+        for _ in range(100):
+            for i, size in enumerate(sizes):
+                assert db_binary[b"k%d" % i] == bytes([i]) * size
+
+    with subtests.test("reads see interleaved rewrites"):
+        for round_ in range(10):
+            payload = bytes([round_]) * 512
+            db_binary[b"hot"] = payload
+            assert db_binary[b"hot"] == payload
+            assert db_binary.getmany([b"hot", b"k0"]) == {
+                b"hot": payload, b"k0": b"\x00" * 10
+            }
+
+
+def test_int_keys(subtests, tmp_path):
+    with LSM(tmp_path / "db.lsm", binary="int") as db:
+        with subtests.test("set, get, contains, delete"):
+            db[42] = b"answer"
+            assert 42 in db
+            assert db[42] == b"answer"
+            del db[42]
+            assert 42 not in db
+            with pytest.raises(KeyError):
+                _ = db[42]
+
+        with subtests.test("iteration is in numeric order"):
+            for key in (300, 5, 70, 1000000, 0):
+                db[key] = str(key).encode()
+            assert list(db.keys()) == [0, 5, 70, 300, 1000000]
+            assert list(db.items()) == [
+                (key, str(key).encode())
+                for key in (0, 5, 70, 300, 1000000)
+            ]
+
+        with subtests.test("slices take int bounds"):
+            assert [key for key, _ in db[5:300]] == [5, 70, 300]
+            assert [key for key, _ in db[1000000:5]] == [1000000, 300, 70, 5]
+            del db[5:70]
+            assert list(db.keys()) == [300, 1000000]
+            del db[0:2000000]
+
+        with subtests.test("bulk operations"):
+            db.update({i: str(i).encode() for i in range(100)})
+            assert db.getmany([1, 2, 200]) == {1: b"1", 2: b"2", 200: None}
+
+            db.bulk_load([(i, b"x") for i in range(100, 200)])
+            assert db[150] == b"x"
+
+            db.delete_many(range(50))
+            assert 0 not in db and 49 not in db and 50 in db
+
+            with db.write_batch() as batch:
+                batch.put(1000, b"batched")
+                batch.delete(50)
+            assert db[1000] == b"batched"
+            assert 50 not in db
+
+        with subtests.test("range helpers"):
+            assert db.count_range(60, 70) == 11
+            assert db.read_range(60, 62) == [
+                (60, b"60"), (61, b"61"), (62, b"62")
+            ]
+
+        with subtests.test("explicit insert and delete"):
+            db.insert(5000, b"v")
+            assert db[5000] == b"v"
+            db.delete(5000)
+            db.insert(5001, b"a")
+            db.insert(5002, b"b")
+            db.delete_range(5000, 5003)
+            assert 5001 not in db and 5002 not in db
+
+        with subtests.test("cursor seek and compare"):
+            with db.cursor() as cursor:
+                assert cursor.seek(60, SEEK_GE)
+                key, value = cursor.retrieve()
+                assert key == 60 and value == b"60"
+                assert cursor.compare(60) == 0
+
+        with subtests.test("wrong key types are rejected"):
+            with pytest.raises(ValueError):
+                _ = db[b"foo"]
+            with pytest.raises(ValueError):
+                db["foo"] = b"bar"
+            with pytest.raises((OverflowError, ValueError)):
+                db[-1] = b"negative"
+
+        with subtests.test("values stay bytes"):
+            with pytest.raises(ValueError):
+                db[1] = "not bytes"
+
+        with subtests.test("snapshot keeps int mode"):
+            with db.snapshot() as snap:
+                assert snap[60] == b"60"
+                assert list(snap[60:62]) == [(60, b"60"), (61, b"61"),
+                                             (62, b"62")]
+
+    with subtests.test("unknown mode string"):
+        with pytest.raises(ValueError):
+            LSM(tmp_path / "other.lsm", binary="hex")
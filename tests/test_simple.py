@@ -1,3 +1,6 @@
+import threading
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 import lsm
 
@@ -89,6 +92,277 @@ def test_db_strings(subtests, tmp_path):
                 _ = db['foo']
 
 
+def test_background_worker(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False,
+                 autowork=False) as db:
+        with subtests.test(msg="start and stop"):
+            assert db.start_worker()
+
+            for i in range(10000):
+                db[f"key_{i}"] = str(i)
+
+            stats = db.worker_stats()
+            assert stats["running"]
+
+            assert db.stop_worker()
+            assert not db.worker_stats()["running"]
+
+        with subtests.test(msg="double start"):
+            assert db.start_worker()
+            with pytest.raises(RuntimeError):
+                db.start_worker()
+            assert db.stop_worker()
+
+        with subtests.test(msg="stop without start"):
+            with pytest.raises(RuntimeError):
+                db.stop_worker()
+
+        with subtests.test(msg="data is intact"):
+            assert db["key_9999"] == "9999"
+
+    with subtests.test(msg="close stops the worker"):
+        db = lsm.LSM(str(tmp_path / "test.lsm"), binary=False)
+        db.open()
+        db.start_worker()
+        db.close()
+
+
+def test_buffered_logging(subtests, tmp_path):
+    received = []
+
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False,
+                 logger=lambda msg, rc: received.append((msg, rc)),
+                 logger_buffered=True) as db:
+        assert db.logger_buffered
+
+        for i in range(1000):
+            db[f"key_{i}"] = str(i)
+        db.work(complete=True)
+
+        with subtests.test(msg="messages arrive only on drain"):
+            assert not received
+            assert db.drain_logs() == len(received)
+
+        with subtests.test(msg="dropped counter is exposed"):
+            assert db.stats()["log_dropped"] >= 0
+
+    with subtests.test(msg="drain requires buffered mode"):
+        with lsm.LSM(str(tmp_path / "plain.lsm"), binary=False) as db:
+            with pytest.raises(RuntimeError):
+                db.drain_logs()
+
+    with subtests.test(msg="buffered mode requires a logger"):
+        with pytest.raises(ValueError):
+            lsm.LSM(str(tmp_path / "test.lsm"), logger_buffered=True)
+
+
+def test_fast_open(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+        for i in range(1000):
+            db[f"key_{i}"] = str(i)
+
+    with subtests.test(msg="eager_work=False skips catch-up on open"):
+        with lsm.LSM(str(tmp_path / "test.lsm"), binary=False,
+                     eager_work=False) as db:
+            assert not db.eager_work
+            assert db["key_999"] == "999"
+            db["key_1000"] = "1000"
+
+    with subtests.test(msg="default stays eager"):
+        with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+            assert db.eager_work
+            assert db["key_1000"] == "1000"
+
+
+def test_parallel_readers(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+        for i in range(10000):
+            db[f"key_{i}"] = str(i)
+
+        def read_all(seed):
+            for i in range(seed, 10000, 8):
+                assert db[f"key_{i}"] == str(i)
+            return sum(1 for _ in db.keys())
+
+        with subtests.test(msg="readers only"):
+            with ThreadPoolExecutor(8) as pool:
+                for result in pool.map(read_all, range(8)):
+                    assert result == 10000
+
+        with subtests.test(msg="readers with a writer"):
+            def write_some(_):
+                for i in range(1000):
+                    db[f"extra_{i}"] = str(i)
+                return 0
+
+            with ThreadPoolExecutor(8) as pool:
+                list(pool.map(read_all, range(7)))
+                list(pool.map(write_some, range(1)))
+
+            assert db["extra_999"] == "999"
+
+
+def test_snapshot(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+        for i in range(1000):
+            db[f"key_{i}"] = str(i)
+
+        with subtests.test(msg="snapshot sees committed data"):
+            with db.snapshot() as snap:
+                assert snap.readonly
+                assert snap["key_999"] == "999"
+                assert sum(1 for _ in snap.keys()) == 1000
+
+        with subtests.test(msg="snapshot rejects writes"):
+            with db.snapshot() as snap:
+                with pytest.raises(PermissionError):
+                    snap["foo"] = "bar"
+
+        with subtests.test(msg="parallel scans over disjoint ranges"):
+            def scan(bounds):
+                start, stop = bounds
+                with db.snapshot() as snap:
+                    return sum(1 for _ in snap[f"key_{start}":f"key_{stop}"])
+
+            with ThreadPoolExecutor(4) as pool:
+                totals = list(pool.map(
+                    scan, [("0", "2"), ("2", "4"), ("4", "6"), ("6", "9")]
+                ))
+            assert sum(totals) > 0
+
+
+def test_group_commit(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False,
+                 safety=lsm.SAFETY_FULL) as db:
+        with subtests.test(msg="sequential group transactions commit"):
+            for i in range(10):
+                with db.transaction(group=True) as tx:
+                    assert tx.group
+                    db[f"seq_{i}"] = str(i)
+            assert db["seq_9"] == "9"
+
+        with subtests.test(msg="exception rolls the batch back"):
+            with pytest.raises(ZeroDivisionError):
+                with db.transaction(group=True):
+                    db["doomed"] = "x"
+                    1 / 0
+            assert "doomed" not in db
+
+        with subtests.test(msg="concurrent commits coalesce"):
+            syncs_before = db.stats()["group_syncs"]
+            barrier = threading.Barrier(8)
+
+            def writer(n):
+                barrier.wait()
+                for i in range(25):
+                    with db.transaction(group=True):
+                        db[f"w{n}_{i}"] = str(i)
+                return n
+
+            with ThreadPoolExecutor(8) as pool:
+                assert sorted(pool.map(writer, range(8))) == list(range(8))
+
+            for n in range(8):
+                for i in range(25):
+                    assert db[f"w{n}_{i}"] == str(i)
+
+            stats = db.stats()
+            assert stats["group_commits"] >= 200
+            assert stats["group_syncs"] - syncs_before <= 200
+
+        with subtests.test(msg="explicit commit rejoins the next batch"):
+            tx = db.transaction(group=True)
+            with tx:
+                db["a"] = "1"
+                tx.commit()
+                db["b"] = "2"
+            assert db["a"] == "1" and db["b"] == "2"
+
+        with subtests.test(msg="mixing with plain transactions"):
+            db.begin()
+            try:
+                with pytest.raises(RuntimeError):
+                    db.transaction(group=True)
+            finally:
+                db.rollback()
+
+        with subtests.test(msg="plain transactions still work"):
+            with db.transaction() as tx:
+                assert not tx.group
+                db["plain"] = "1"
+            assert db["plain"] == "1"
+
+
+def test_advise(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+        for i in range(1000):
+            db[f"key_{i}"] = str(i)
+
+        with subtests.test(msg="whole-file advice"):
+            assert db.advise("sequential") is None
+            assert db.advise("random") is None
+            assert db.advise("willneed") is None
+            assert db.advise("dontneed") is None
+
+        with subtests.test(msg="byte range"):
+            assert db.advise("willneed", offset=0, length=4096) is None
+
+        with subtests.test(msg="invalid mode"):
+            with pytest.raises(ValueError):
+                db.advise("everything")
+
+        with subtests.test(msg="negative range"):
+            with pytest.raises(ValueError):
+                db.advise("random", offset=-1)
+
+    with subtests.test(msg="closed database"):
+        with pytest.raises(RuntimeError):
+            db.advise("sequential")
+
+
+def test_backup(subtests, tmp_path):
+    with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
+        for i in range(5000):
+            db[f"key_{i}"] = str(i)
+
+        with subtests.test(msg="backup is complete and readable"):
+            copied = db.backup(str(tmp_path / "backup.lsm"))
+            assert copied == 5000
+
+            with lsm.LSM(str(tmp_path / "backup.lsm"), binary=False,
+                         readonly=True) as backup:
+                assert backup["key_4999"] == "4999"
+                assert sum(1 for _ in backup.keys()) == 5000
+
+        with subtests.test(msg="progress is reported"):
+            ticks = []
+            db.backup(str(tmp_path / "backup2.lsm"), chunk_size=4096,
+                      progress=lambda entries, nbytes: ticks.append(
+                          (entries, nbytes)))
+            assert ticks
+            assert ticks[-1][0] == 5000
+
+        with subtests.test(msg="writers keep working during backup"):
+            def slow_progress(entries, nbytes):
+                db[f"during_{entries}"] = "x"
+
+            db.backup(str(tmp_path / "backup3.lsm"), chunk_size=4096,
+                      progress=slow_progress)
+            assert any(key.startswith("during_") for key in db.keys())
+
+        with subtests.test(msg="chunk_size is validated"):
+            with pytest.raises(ValueError):
+                db.backup(str(tmp_path / "nope.lsm"), chunk_size=1)
+
+        with subtests.test(msg="progress errors abort the backup"):
+            def broken(entries, nbytes):
+                raise RuntimeError("stop")
+
+            with pytest.raises(RuntimeError):
+                db.backup(str(tmp_path / "nope.lsm"), chunk_size=4096,
+                          progress=broken)
+
+
 def test_db_cursors(subtests, tmp_path):
     with lsm.LSM(str(tmp_path / "test.lsm"), binary=False) as db:
         for i in range(10):